@@ -35,6 +35,10 @@
 
 #include "analysis/analyzers.hpp"
 #include "utils/hash_utils.hpp"
+#include "utils/object_pool.hpp"
+
+#include <mutex>
+#include <unordered_map>
 
 NS_LOCAL
 
@@ -121,6 +125,48 @@ class analyzer_register
   }
 };
 
+struct analyzer_builder {
+  typedef analysis::analyzer::ptr ptr;
+
+  static ptr make(analysis::factory_f factory, const string_ref& args) {
+    return factory(args);
+  }
+};
+
+// max number of idle instances kept per analyzer configuration
+constexpr size_t POOL_SIZE = 64;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief pools of analyzers keyed by analyzer type, arguments format and
+///        normalized arguments, pools are never removed, volatile pools allow
+///        pooled instances to outlive the registry at shutdown
+////////////////////////////////////////////////////////////////////////////////
+class analyzer_pools {
+ public:
+  typedef irs::unbounded_object_pool_volatile<analyzer_builder> pool_t;
+
+  static analyzer_pools& instance() {
+    static analyzer_pools pools;
+    return pools;
+  }
+
+  pool_t& get(std::string&& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto& pool = pools_[std::move(key)];
+
+    if (!pool) {
+      pool = irs::memory::make_unique<pool_t>(POOL_SIZE);
+    }
+
+    return *pool;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<pool_t>> pools_;
+};
+
 NS_END
 
 NS_ROOT
@@ -203,6 +249,45 @@ NS_BEGIN(analysis)
   return nullptr;
 }
 
+/*static*/ analyzer::ptr analyzers::get_pooled(
+    const string_ref& name,
+    const type_info& args_format,
+    const string_ref& args,
+    bool load_library /*= true*/) noexcept {
+  try {
+    const auto entry = analyzer_register::instance().get(
+      ::key(name, args_format),
+      load_library);
+
+    if (!entry.factory) {
+      return nullptr;
+    }
+
+    std::string config;
+
+    if (!entry.normalizer || !entry.normalizer(args, config)) {
+      return entry.factory(args);
+    }
+
+    // analyzer type, arguments format and normalized arguments
+    std::string key(name.c_str(), name.size());
+    key += '\0';
+    key.append(args_format.name().c_str(), args_format.name().size());
+    key += '\0';
+    key += config;
+
+    auto& pool = analyzer_pools::instance().get(std::move(key));
+    auto analyzer = pool.emplace(entry.factory, config);
+
+    return analyzer ? analyzer.release() : nullptr;
+  } catch (...) {
+    IR_FRMT_ERROR("Caught exception while getting a pooled analyzer instance");
+    IR_LOG_EXCEPTION();
+  }
+
+  return nullptr;
+}
+
 /*static*/ void analyzers::init() {
   #ifndef IRESEARCH_DLL
     irs::analysis::delimited_token_stream::init();
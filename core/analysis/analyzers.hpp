@@ -119,6 +119,20 @@ class IRESEARCH_API analyzers {
     const string_ref& args,
     bool load_library = true) noexcept;
 
+  ////////////////////////////////////////////////////////////////////////////////
+  /// @brief find an analyzer by name and take an instance from a pool of
+  ///        analyzers of the same type and normalized arguments, the instance
+  ///        goes back to the pool once the last reference to it is released
+  ///        so that subsequent calls don't pay for analyzer construction
+  /// @returns nullptr if not found or on failure to instantiate an analyzer
+  /// @note arguments that can't be normalized produce a non-pooled instance
+  ////////////////////////////////////////////////////////////////////////////////
+  static analyzer::ptr get_pooled(
+    const string_ref& name,
+    const type_info& args_format,
+    const string_ref& args,
+    bool load_library = true) noexcept;
+
   ////////////////////////////////////////////////////////////////////////////////
   /// @brief for static lib reference all known scorers in lib
   ///        for shared lib NOOP
@@ -357,6 +357,23 @@ bool ngram_token_stream_base::reset(const irs::string_ref& value) noexcept {
   data_end_ = data_.end();
   offset_.start = 0;
   length_ = 0;
+  begin_symbol_ = 0;
+  ngram_end_symbol_ = 0;
+
+  if (InputType::UTF8 == options_.stream_bytes_type) {
+    try {
+      symbols_.reserve(data_.size() + 1);
+    } catch (...) {
+      return false;
+    }
+
+    symbols_.clear();
+    for (auto it = begin_; it < data_end_; it = utf8_utils::next(it, data_end_)) {
+      symbols_.push_back(static_cast<uint32_t>(std::distance(begin_, it)));
+    }
+    symbols_.push_back(static_cast<uint32_t>(data_.size()));
+  }
+
   if (options_.preserve_original) {
     if (!start_marker_empty_) {
       emit_original_ = EmitOriginal::WithStartMarker;
@@ -386,13 +403,17 @@ bool ngram_token_stream_base::reset(const irs::string_ref& value) noexcept {
 }
 
 template<irs::analysis::ngram_token_stream_base::InputType StreamType>
-bool ngram_token_stream<StreamType>::next_symbol(const byte_type*& it) const noexcept {
+bool ngram_token_stream<StreamType>::next_symbol(
+    const byte_type*& it,
+    size_t& symbol) const noexcept {
   IRS_ASSERT(it);
   if (it < data_end_) {
     if constexpr (StreamType == InputType::Binary) {
+      UNUSED(symbol);
       ++it;
     } else if constexpr (StreamType == InputType::UTF8) {
-      it = irs::utf8_utils::next(it, data_end_);
+      IRS_ASSERT(symbol + 1 < symbols_.size());
+      it = data_.begin() + symbols_[++symbol];
     }
     return true;
   }
@@ -402,7 +423,7 @@ bool ngram_token_stream<StreamType>::next_symbol(const byte_type*& it) const noe
 template<irs::analysis::ngram_token_stream_base::InputType StreamType>
 bool ngram_token_stream<StreamType>::next() noexcept {
   while (begin_ < data_end_) {
-    if (length_ < options_.max_gram && next_symbol(ngram_end_)) {
+    if (length_ < options_.max_gram && next_symbol(ngram_end_, ngram_end_symbol_)) {
       // we have next ngram from current position
       ++length_;
       if (length_ >= options_.min_gram) {
@@ -444,10 +465,11 @@ bool ngram_token_stream<StreamType>::next() noexcept {
     } else {
       // need to move to next position
       if (EmitOriginal::None == emit_original_) {
-        if (next_symbol(begin_)) {
+        if (next_symbol(begin_, begin_symbol_)) {
           next_inc_val_ = 1;
           length_ = 0;
           ngram_end_ = begin_;
+          ngram_end_symbol_ = begin_symbol_;
           offset_.start = static_cast<uint32_t>(std::distance(data_.begin(), begin_));
         } else {
           return false; // stream exhausted
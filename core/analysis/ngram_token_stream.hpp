@@ -23,6 +23,8 @@
 #ifndef IRESEARCH_NGRAM_TOKEN_STREAM_H
 #define IRESEARCH_NGRAM_TOKEN_STREAM_H
 
+#include <vector>
+
 #include "analyzers.hpp"
 #include "token_attributes.hpp"
 #include "utils/frozen_attributes.hpp"
@@ -99,6 +101,13 @@ class ngram_token_stream_base
    const byte_type* data_end_{};
    const byte_type* ngram_end_{};
    size_t length_{};
+
+   // offsets of the symbols of UTF8 input followed by the input size,
+   // computed once per input instead of decoding every symbol of every
+   // ngram starting at each position
+   std::vector<uint32_t> symbols_;
+   size_t begin_symbol_{}; // index of 'begin_' in 'symbols_'
+   size_t ngram_end_symbol_{}; // index of 'ngram_end_' in 'symbols_'
   
    enum class EmitOriginal {
      None,
@@ -132,7 +141,7 @@ class ngram_token_stream: public ngram_token_stream_base {
   virtual bool next() noexcept override;
 
  private:
-  inline bool next_symbol(const byte_type*& it) const noexcept;
+  inline bool next_symbol(const byte_type*& it, size_t& symbol) const noexcept;
 }; // ngram_token_stream
 
 NS_END
@@ -0,0 +1,177 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "pre_analyzed_token_stream.hpp"
+
+#include "utils/bytes_utils.hpp"
+
+#include <iterator>
+
+NS_LOCAL
+
+using namespace irs;
+
+// reads a variable-size encoded value written by 'irs::vwrite<uint32_t>(...)'
+// without reading past 'end'
+bool read_vint(
+    const byte_type*& it,
+    const byte_type* end,
+    uint32_t& value) noexcept {
+  uint32_t out = 0;
+
+  for (uint32_t shift = 0; it != end && shift < 32; shift += 7) {
+    const uint32_t b = *it++;
+    out |= (b & 0x7F) << shift;
+
+    if (!(b & 0x80)) {
+      value = out;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool read_bytes(
+    const byte_type*& it,
+    const byte_type* end,
+    bytes_ref& value) noexcept {
+  uint32_t size;
+
+  if (!read_vint(it, end, size) || size_t(end - it) < size) {
+    return false;
+  }
+
+  value = bytes_ref(it, size);
+  it += size;
+
+  return true;
+}
+
+void write_bytes(std::back_insert_iterator<bstring>& out, const bytes_ref& value) {
+  vwrite(out, uint32_t(value.size()));
+  std::copy(value.begin(), value.end(), out);
+}
+
+NS_END
+
+NS_ROOT
+
+/*static*/ bool pre_analyzed_token_stream::write(
+    token_stream& tokens,
+    byte_type features,
+    bstring& out) {
+  const auto* term = irs::get<term_attribute>(tokens);
+  const auto* inc = irs::get<increment>(tokens);
+  const auto* offs = irs::get<offset>(tokens);
+  const auto* pay = irs::get<payload>(tokens);
+
+  if (!term || !inc) {
+    return false;
+  }
+
+  auto it = std::back_inserter(out);
+  *it = FORMAT_VERSION;
+  *it = features;
+
+  for (uint32_t start = 0; tokens.next(); ) {
+    write_bytes(it, term->value);
+    vwrite(it, inc->value);
+
+    if (features & OFFSETS) {
+      const uint32_t token_start = offs ? offs->start : start;
+      const uint32_t token_end = offs ? offs->end : token_start;
+
+      if (token_start < start || token_end < token_start) {
+        return false;
+      }
+
+      vwrite(it, token_start - start);
+      vwrite(it, token_end - token_start);
+      start = token_start;
+    }
+
+    if (features & PAYLOADS) {
+      write_bytes(it, pay ? pay->value : bytes_ref::EMPTY);
+    }
+  }
+
+  return true;
+}
+
+pre_analyzed_token_stream::pre_analyzed_token_stream() noexcept
+  : attributes{{
+      { type<increment>::id(),      &inc_     },
+      { type<offset>::id(),         &offset_  },
+      { type<payload>::id(),        &payload_ },
+      { type<term_attribute>::id(), &term_    }
+    }} {
+}
+
+bool pre_analyzed_token_stream::reset(const bytes_ref& data) noexcept {
+  begin_ = end_ = nullptr;
+  features_ = NONE;
+  offset_.clear();
+  payload_.value = bytes_ref::NIL;
+  term_.value = bytes_ref::NIL;
+
+  if (data.size() < 2 || FORMAT_VERSION != data[0]
+      || (data[1] & ~byte_type(OFFSETS | PAYLOADS))) {
+    return false;
+  }
+
+  features_ = data[1];
+  begin_ = data.begin() + 2;
+  end_ = data.end();
+
+  return true;
+}
+
+bool pre_analyzed_token_stream::next() noexcept {
+  if (begin_ == end_) {
+    return false;
+  }
+
+  auto* it = begin_;
+
+  if (!read_bytes(it, end_, term_.value)
+      || !read_vint(it, end_, inc_.value)) {
+    return false;
+  }
+
+  uint32_t start = 0, length = 0;
+
+  if ((features_ & OFFSETS)
+      && (!read_vint(it, end_, start) || !read_vint(it, end_, length))) {
+    return false;
+  }
+
+  if ((features_ & PAYLOADS) && !read_bytes(it, end_, payload_.value)) {
+    return false;
+  }
+
+  offset_.start += start;
+  offset_.end = offset_.start + length;
+  begin_ = it;
+
+  return true;
+}
+
+NS_END
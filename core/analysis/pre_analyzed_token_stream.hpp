@@ -0,0 +1,97 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_PRE_ANALYZED_TOKEN_STREAM_H
+#define IRESEARCH_PRE_ANALYZED_TOKEN_STREAM_H
+
+#include "token_stream.hpp"
+#include "token_attributes.hpp"
+#include "utils/frozen_attributes.hpp"
+
+NS_ROOT
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class pre_analyzed_token_stream
+/// @brief token_stream over a field analyzed elsewhere and serialized to
+///        the binary format below, term and payload values reference the
+///        input buffer directly, i.e. the buffer must outlive the tokens
+///
+///   field   := version:byte features:byte token*
+///   token   := term_size:vint term:bytes increment:vint
+///              [start_delta:vint length:vint] (if features & OFFSETS)
+///              [payload_size:vint payload:bytes] (if features & PAYLOADS)
+///
+/// 'start_delta' is relative to the start offset of the previous token
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API pre_analyzed_token_stream final
+    : public frozen_attributes<4, token_stream>,
+      private util::noncopyable {
+ public:
+  static constexpr byte_type FORMAT_VERSION = 0;
+
+  enum features_t : byte_type {
+    NONE = 0,
+    OFFSETS = 1,
+    PAYLOADS = 2
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief serializes all tokens of the specified stream to 'out'
+  /// @param features attributes of the stream to serialize in addition to
+  ///        terms and increments, a missing attribute is written as empty
+  /// @returns false if the stream doesn't fit into the format, e.g. lacks
+  ///          a term attribute or produces decreasing start offsets
+  //////////////////////////////////////////////////////////////////////////////
+  static bool write(token_stream& tokens, byte_type features, bstring& out);
+
+  pre_analyzed_token_stream() noexcept;
+
+  virtual bool next() noexcept override;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns false if 'data' is not a field in a known format
+  //////////////////////////////////////////////////////////////////////////////
+  bool reset(const bytes_ref& data) noexcept;
+
+  bool reset(const string_ref& data) noexcept {
+    return reset(ref_cast<byte_type>(data));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if all tokens of the field have been read, false if
+  ///          'next()' stopped on truncated or malformed data
+  //////////////////////////////////////////////////////////////////////////////
+  bool eof() const noexcept { return begin_ == end_; }
+
+  byte_type features() const noexcept { return features_; }
+
+ private:
+  increment inc_;
+  offset offset_;
+  payload payload_;
+  term_attribute term_;
+  const byte_type* begin_{};
+  const byte_type* end_{};
+  byte_type features_{NONE};
+}; // pre_analyzed_token_stream
+
+NS_END
+
+#endif // IRESEARCH_PRE_ANALYZED_TOKEN_STREAM_H
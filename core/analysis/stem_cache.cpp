@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "stem_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "utils/math_utils.hpp"
+
+NS_LOCAL
+
+// table is kept at most half full
+constexpr size_t LOAD_FACTOR = 2;
+
+// average size of a cached word and its stem
+constexpr size_t AVG_ENTRY_SIZE = 16;
+
+NS_END
+
+NS_ROOT
+NS_BEGIN(analysis)
+
+stem_cache::stem_cache(size_t capacity /*= DEFAULT_CAPACITY*/)
+  : slots_(math::roundup_power2(std::max(size_t(1), capacity) * LOAD_FACTOR)),
+    capacity_(std::max(size_t(1), capacity)) {
+  arena_.reserve(capacity_ * AVG_ENTRY_SIZE);
+}
+
+bool stem_cache::find(const bytes_ref& word, bytes_ref& stem) noexcept {
+  if (word.empty() || word.size() > MAX_SIZE) {
+    ++misses_;
+    return false;
+  }
+
+  const auto hash = uint32_t(std::hash<bytes_ref>()(word));
+  const size_t mask = slots_.size() - 1;
+
+  for (auto i = hash & mask; slots_[i].word_size; i = (i + 1) & mask) {
+    auto& entry = slots_[i];
+
+    if (entry.hash == hash
+        && entry.word_size == word.size()
+        && !std::memcmp(arena_.c_str() + entry.offset, word.c_str(), word.size())) {
+      stem = bytes_ref(arena_.c_str() + entry.offset + entry.word_size, entry.stem_size);
+      ++hits_;
+      return true;
+    }
+  }
+
+  ++misses_;
+  return false;
+}
+
+void stem_cache::emplace(const bytes_ref& word, const bytes_ref& stem) {
+  if (word.empty() || word.size() > MAX_SIZE || stem.size() > MAX_SIZE) {
+    return; // not cached
+  }
+
+  if (size_ >= capacity_ || arena_.size() + word.size() + stem.size() > arena_.capacity()) {
+    clear(); // drop everything, frequent words get back quickly
+  }
+
+  const auto hash = uint32_t(std::hash<bytes_ref>()(word));
+  const size_t mask = slots_.size() - 1;
+
+  auto i = hash & mask;
+  for (; slots_[i].word_size; i = (i + 1) & mask) {
+    auto& entry = slots_[i];
+
+    if (entry.hash == hash
+        && entry.word_size == word.size()
+        && !std::memcmp(arena_.c_str() + entry.offset, word.c_str(), word.size())) {
+      return; // already cached
+    }
+  }
+
+  auto& entry = slots_[i];
+  entry.hash = hash;
+  entry.offset = uint32_t(arena_.size());
+  entry.word_size = uint8_t(word.size());
+  entry.stem_size = uint8_t(stem.size());
+
+  arena_.append(word.c_str(), word.size());
+  arena_.append(stem.c_str(), stem.size());
+  ++size_;
+}
+
+void stem_cache::clear() noexcept {
+  std::fill(slots_.begin(), slots_.end(), slot{});
+  arena_.clear(); // capacity is kept
+  size_ = 0;
+}
+
+NS_END // analysis
+NS_END // ROOT
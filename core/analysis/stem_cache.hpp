@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_STEM_CACHE_H
+#define IRESEARCH_STEM_CACHE_H
+
+#include <vector>
+
+#include "shared.hpp"
+#include "utils/noncopyable.hpp"
+#include "utils/string.hpp"
+
+NS_ROOT
+NS_BEGIN(analysis)
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class stem_cache
+/// @brief a bounded cache of word stems for a single analyzer instance,
+///        natural language word frequencies are Zipfian so that most of the
+///        words are found in a small cache
+/// @note words and stems are stored in a preallocated arena and looked up in
+///       an open-addressing table, the whole cache is dropped once full
+/// @note not thread-safe
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API stem_cache : private util::noncopyable {
+ public:
+  static constexpr size_t DEFAULT_CAPACITY = 4096; // number of cached words
+  static constexpr size_t MAX_SIZE = 64; // longer words/stems aren't cached
+
+  explicit stem_cache(size_t capacity = DEFAULT_CAPACITY);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief finds a stem of the specified word
+  /// @returns true if found, 'stem' is valid till the next call to 'emplace'
+  //////////////////////////////////////////////////////////////////////////////
+  bool find(const bytes_ref& word, bytes_ref& stem) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief caches a stem of the specified word, the cache is cleared if
+  ///        there is no space left
+  //////////////////////////////////////////////////////////////////////////////
+  void emplace(const bytes_ref& word, const bytes_ref& stem);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief removes all cached words, counters are kept
+  //////////////////////////////////////////////////////////////////////////////
+  void clear() noexcept;
+
+  size_t capacity() const noexcept { return capacity_; }
+  size_t size() const noexcept { return size_; }
+  size_t hits() const noexcept { return hits_; }
+  size_t misses() const noexcept { return misses_; }
+
+ private:
+  struct slot {
+    uint32_t hash;
+    uint32_t offset; // offset of the word followed by the stem in 'arena_'
+    uint8_t word_size; // 0 - empty slot
+    uint8_t stem_size;
+  };
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  std::vector<slot> slots_;
+  bstring arena_;
+  size_t capacity_;
+  size_t size_{};
+  size_t hits_{};
+  size_t misses_{};
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // stem_cache
+
+NS_END // analysis
+NS_END // ROOT
+
+#endif // IRESEARCH_STEM_CACHE_H
@@ -257,6 +257,12 @@ bool text_token_stemming_stream::reset(const irs::string_ref& data) {
       term_buf_.resize(irs::integer_traits<int>::const_max);
     }
 
+    const auto word = irs::ref_cast<irs::byte_type>(term_buf_);
+
+    if (cache_.find(word, term_.value)) {
+      return true;
+    }
+
     static_assert(sizeof(sb_symbol) == sizeof(char), "sizeof(sb_symbol) != sizeof(char)");
     const auto* value = reinterpret_cast<sb_symbol const*>(term_buf_.c_str());
 
@@ -266,6 +272,7 @@ bool text_token_stemming_stream::reset(const irs::string_ref& data) {
       static_assert(sizeof(irs::byte_type) == sizeof(sb_symbol), "sizeof(irs::byte_type) != sizeof(sb_symbol)");
       term_.value = irs::bytes_ref(reinterpret_cast<const irs::byte_type*>(value),
                                    sb_stemmer_length(stemmer_.get()));
+      cache_.emplace(word, term_.value);
 
       return true;
     }
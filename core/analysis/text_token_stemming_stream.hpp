@@ -25,6 +25,7 @@
 #define IRESEARCH_TEXT_TOKEN_STEMMING_STREAM_H
 
 #include "analyzers.hpp"
+#include "stem_cache.hpp"
 #include "token_attributes.hpp"
 #include "utils/frozen_attributes.hpp"
 
@@ -55,6 +56,7 @@ class text_token_stemming_stream final
    offset offset_;
    payload payload_; // raw token value
    std::shared_ptr<sb_stemmer> stemmer_;
+   stem_cache cache_; // stems of the recently seen words
    term_attribute term_; // token value with evaluated quotes
    std::string term_buf_; // buffer for the last evaluated term
    bool term_eof_;
@@ -67,6 +67,7 @@
 #include "utils/thread_utils.hpp"
 #include "utils/utf8_path.hpp"
 
+#include "stem_cache.hpp"
 #include "text_token_stream.hpp"
 
 NS_ROOT
@@ -89,6 +90,7 @@ struct text_token_stream::state_t {
   const options_t& options;
   const stopwords_t& stopwords;
   std::shared_ptr<sb_stemmer> stemmer;
+  irs::analysis::stem_cache stems; // stems of the recently seen words
   std::string tmp_buf; // used by processTerm(...)
   std::shared_ptr<icu::Transliterator> transliterator;
   ngram_state_t ngram;
@@ -422,6 +424,12 @@ bool process_term(
   // find the token stem
   // ...........................................................................
   if (state.stemmer) {
+    const auto word = irs::ref_cast<irs::byte_type>(word_utf8);
+
+    if (state.stems.find(word, state.term)) {
+      return true;
+    }
+
     static_assert(sizeof(sb_symbol) == sizeof(char), "sizeof(sb_symbol) != sizeof(char)");
     const sb_symbol* value = reinterpret_cast<sb_symbol const*>(word_utf8.c_str());
 
@@ -431,6 +439,7 @@ bool process_term(
       static_assert(sizeof(irs::byte_type) == sizeof(sb_symbol), "sizeof(irs::byte_type) != sizeof(sb_symbol)");
       state.term = irs::bytes_ref(reinterpret_cast<const irs::byte_type*>(value),
                                   sb_stemmer_length(state.stemmer.get()));
+      state.stems.emplace(word, state.term);
 
       return true;
     }
@@ -183,7 +183,11 @@ class IRESEARCH_API position
     return pos ? *pos : *empty();
   }
 
-  value_t seek(value_t target) {
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief moves iterator to the first position not less than the target
+  /// @note implementations may override it to avoid per position overhead
+  //////////////////////////////////////////////////////////////////////////////
+  virtual value_t seek(value_t target) {
     while ((value_< target) && next());
     return value_;
   }
@@ -1492,6 +1492,41 @@ class position final : public irs::position,
     return true;
   }
 
+  virtual value_t seek(value_t target) override {
+    while (value_ < target) {
+      if constexpr (!IteratorTraits::offset() && !IteratorTraits::payload()) {
+        // there are no per position attributes, so we can scan the
+        // remainder of decoded positions block without virtual calls
+        // and any additional bookkeeping
+        if (pos_limits::valid(value_) &&
+            this->buf_pos_ < postings_writer_base::BLOCK_SIZE &&
+            this->pend_pos_) {
+          assert(this->pend_pos_ <= *this->freq_);
+          const uint32_t* begin = this->pos_deltas_ + this->buf_pos_;
+          const uint32_t* end = begin + std::min(
+            uint32_t(postings_writer_base::BLOCK_SIZE) - this->buf_pos_,
+            this->pend_pos_);
+          const uint32_t* delta = begin;
+
+          for (; delta != end && value_ < target; ++delta) {
+            value_ += *delta;
+          }
+
+          const auto count = uint32_t(delta - begin);
+          this->buf_pos_ += count;
+          this->pend_pos_ -= count;
+          continue;
+        }
+      }
+
+      if (!next()) {
+        break;
+      }
+    }
+
+    return value_;
+  }
+
   virtual void reset() override {
     value_ = pos_limits::invalid();
     impl::reset();
@@ -1680,31 +1715,40 @@ class doc_iterator final
       refill();
     }
 
-    while (begin_ < end_) {
-      doc_.value += *begin_++;
-
-      if constexpr (!IteratorTraits::position()) {
-        if (doc_.value >= target) {
-          if constexpr (IteratorTraits::frequency()) {
-            doc_freq_ = doc_freqs_ + relative_pos();
-            assert((doc_freq_ - 1) >= doc_freqs_ && (doc_freq_ - 1) < std::end(doc_freqs_));
-            freq_.value = doc_freq_[-1];
-          }
-          return doc_.value;
-        }
-      } else {
-        assert(IteratorTraits::frequency());
-        freq_.value = *doc_freq_++;
+    // documents in a block are sorted, so find the
+    // first one not less than target via galloping search
+    const auto* it = gallop(begin_, end_, target);
 
-        pos_.notify(freq_.value);
+    if (it != end_) {
+      const auto count = size_t(std::distance(begin_, it)) + 1;
+      begin_ = it + 1;
+      doc_.value = *it;
 
-        if (doc_.value >= target) {
+      if constexpr (IteratorTraits::frequency()) {
+        if constexpr (IteratorTraits::position()) {
+          // notify positions about all skipped documents at once
+          pos_.notify(std::accumulate(doc_freq_, doc_freq_ + count, uint32_t(0)));
           pos_.clear();
-          return doc_.value;
         }
+
+        doc_freq_ = doc_freqs_ + relative_pos();
+        assert((doc_freq_ - 1) >= doc_freqs_ && (doc_freq_ - 1) < std::end(doc_freqs_));
+        freq_.value = doc_freq_[-1];
       }
+
+      return doc_.value;
     }
 
+    // the whole block is less than target, positions will be
+    // notified once iterator moves to the next one
+    if constexpr (IteratorTraits::position()) {
+      auto* freq_end = doc_freqs_ + size_t(end_ - docs_);
+      pos_.notify(std::accumulate(doc_freq_, freq_end, uint32_t(0)));
+      doc_freq_ = freq_end;
+    }
+    doc_.value = end_[-1];
+    begin_ = end_;
+
     while (doc_.value < target) {
       next();
     }
@@ -1736,7 +1780,7 @@ class doc_iterator final
       refill();
     }
 
-    doc_.value += *begin_++; // update document attribute
+    doc_.value = *begin_++; // update document attribute
 
     if constexpr (IteratorTraits::frequency()) {
       freq_.value = *doc_freq_++; // update frequency attribute
@@ -1759,6 +1803,24 @@ class doc_iterator final
  private:
   void seek_to_block(doc_id_t target);
 
+  // returns the first document in [begin, end) not less than target,
+  // probes 1, 2, 4, ... documents ahead to narrow down the range
+  // for the binary search, since seeks are usually short
+  static const doc_id_t* gallop(
+      const doc_id_t* begin,
+      const doc_id_t* end,
+      doc_id_t target) noexcept {
+    size_t step = 1;
+    const auto* lo = begin;
+    while (lo < end && *lo < target) {
+      begin = lo + 1;
+      lo = size_t(std::distance(lo, end)) > step ? lo + step : end;
+      step <<= 1;
+    }
+
+    return std::lower_bound(begin, lo, target);
+  }
+
   // returns current position in the document block 'docs_'
   size_t relative_pos() noexcept {
     assert(begin_ >= docs_);
@@ -1806,6 +1868,7 @@ class doc_iterator final
   void refill() {
     // should never call refill for singleton documents
     assert(1 != term_state_.docs_count);
+    timer_utils::count(timer_utils::metric::POSTINGS_BLOCK_DECODE);
     const auto left = term_state_.docs_count - cur_pos_;
 
     if (left >= postings_writer_base::BLOCK_SIZE) {
@@ -1835,6 +1898,14 @@ class doc_iterator final
       doc_.value = (doc_limits::min)();
     }
 
+    // convert deltas into absolute document ids
+    // to allow binary search within a block
+    doc_id_t doc = doc_.value;
+    for (auto* it = docs_; it != end_; ++it) {
+      doc += *it;
+      *it = doc;
+    }
+
     begin_ = docs_;
     doc_freq_ = doc_freqs_;
   }
@@ -4216,6 +4287,7 @@ class read_context
 
   template<typename Block>
   void load(Block& block, compression::decompressor* decomp, bool decrypt, uint64_t offset) {
+    timer_utils::scoped_metric metric(timer_utils::metric::COLUMN_BLOCK_LOAD);
     stream_->seek(offset); // seek to the offset
     block.load(*stream_, decomp, decrypt ? cipher_ : nullptr, buf_);
   }
@@ -5557,7 +5629,7 @@ class format11 : public format10 {
 
   virtual index_meta_writer::ptr get_index_meta_writer() const override final;
 
-  virtual field_writer::ptr get_field_writer(bool volatile_state) const override final;
+  virtual field_writer::ptr get_field_writer(bool volatile_state) const override;
 
   virtual segment_meta_writer::ptr get_segment_meta_writer() const override final;
 
@@ -5579,7 +5651,7 @@ field_writer::ptr format11::get_field_writer(bool volatile_state) const {
   return irs::field_writer::make<burst_trie::field_writer>(
     get_postings_writer(volatile_state),
     volatile_state,
-    int32_t(burst_trie::field_writer::FORMAT_MAX)
+    int32_t(burst_trie::field_writer::FORMAT_ENCRYPTION)
   );
 }
 
@@ -5689,6 +5761,45 @@ irs::postings_reader::ptr format13::get_postings_reader() const {
 
 REGISTER_FORMAT_MODULE(::format13, MODULE_NAME);
 
+// ----------------------------------------------------------------------------
+// --SECTION--                                                         format14
+// ----------------------------------------------------------------------------
+
+class format14 : public format13 {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "1_4";
+  }
+
+  DECLARE_FACTORY();
+
+  format14() noexcept : format13(irs::type<format14>::get()) { }
+
+  virtual field_writer::ptr get_field_writer(bool volatile_state) const override final;
+
+ protected:
+  explicit format14(const irs::type_info& type) noexcept
+    : format13(type) {
+  }
+}; // format14
+
+field_writer::ptr format14::get_field_writer(bool volatile_state) const {
+  return irs::field_writer::make<burst_trie::field_writer>(
+    get_postings_writer(volatile_state),
+    volatile_state,
+    int32_t(burst_trie::field_writer::FORMAT_FST_OFFSETS)
+  );
+}
+
+/*static*/ irs::format::ptr format14::make() {
+  static const ::format14 INSTANCE;
+
+  // aliasing constructor
+  return irs::format::ptr(irs::format::ptr(), &INSTANCE);
+}
+
+REGISTER_FORMAT_MODULE(::format14, MODULE_NAME);
+
 // ----------------------------------------------------------------------------
 // --SECTION--                                                      format12sse
 // ----------------------------------------------------------------------------
@@ -5792,6 +5903,47 @@ irs::postings_reader::ptr format13simd::get_postings_reader() const {
 
 REGISTER_FORMAT_MODULE(::format13simd, MODULE_NAME);
 
+// ----------------------------------------------------------------------------
+// --SECTION--                                                      format14sse
+// ----------------------------------------------------------------------------
+
+class format14simd final : public format14 {
+ public:
+  static constexpr string_ref type_name() noexcept {
+    return "1_4simd";
+  }
+
+  DECLARE_FACTORY();
+
+  format14simd() noexcept : format14(irs::type<format14simd>::get()) { }
+
+  virtual irs::postings_writer::ptr get_postings_writer(bool volatile_state) const override;
+  virtual irs::postings_reader::ptr get_postings_reader() const override;
+}; // format14simd
+
+irs::postings_writer::ptr format14simd::get_postings_writer(bool volatile_state) const {
+  constexpr const auto VERSION = postings_writer_base::FORMAT_SSE_POSITIONS_ZEROBASED;
+
+  if (volatile_state) {
+    return memory::make_unique<::postings_writer<format_traits_simd, true>>(VERSION);
+  }
+
+  return memory::make_unique<::postings_writer<format_traits_simd, false>>(VERSION);
+}
+
+irs::postings_reader::ptr format14simd::get_postings_reader() const {
+  return irs::postings_reader::make<::postings_reader<format_traits_simd, false>>();
+}
+
+/*static*/ irs::format::ptr format14simd::make() {
+  static const ::format14simd INSTANCE;
+
+  // aliasing constructor
+  return irs::format::ptr(irs::format::ptr(), &INSTANCE);
+}
+
+REGISTER_FORMAT_MODULE(::format14simd, MODULE_NAME);
+
 #endif // IRESEARCH_SSE2
 
 NS_END
@@ -5805,9 +5957,11 @@ void init() {
   REGISTER_FORMAT(::format11);
   REGISTER_FORMAT(::format12);
   REGISTER_FORMAT(::format13);
+  REGISTER_FORMAT(::format14);
 #ifdef IRESEARCH_SSE2
   REGISTER_FORMAT(::format12simd);
   REGISTER_FORMAT(::format13simd);
+  REGISTER_FORMAT(::format14simd);
 #endif // IRESEARCH_SSE2
 #endif
 }
@@ -615,9 +615,9 @@ class term_iterator_base
     return owner_->field_;
   }
 
-  fst_t& fst() const noexcept {
-    assert(owner_ && owner_->fst_);
-    return *owner_->fst_;
+  const fst_t& fst() const {
+    assert(owner_);
+    return owner_->fst();
   }
 
   const term_reader* owner_;
@@ -1607,6 +1607,8 @@ bool term_iterator::seek_to_block(const bytes_ref& term, size_t& prefix) {
 }
 
 SeekResult term_iterator::seek_equal(const bytes_ref& term) {
+  timer_utils::count(timer_utils::metric::TERM_SEEK);
+
   size_t prefix;
   if (seek_to_block(term, prefix)) {
     return SeekResult::FOUND;
@@ -1635,6 +1637,8 @@ SeekResult term_iterator::seek_equal(const bytes_ref& term) {
 }
 
 SeekResult term_iterator::seek_ge(const bytes_ref& term) {
+  timer_utils::count(timer_utils::metric::TERM_SEEK);
+
   size_t prefix;
   if (seek_to_block(term, prefix)) {
     return SeekResult::FOUND;
@@ -1701,7 +1705,8 @@ term_reader::term_reader(term_reader&& rhs) noexcept
     doc_freq_(rhs.doc_freq_),
     term_freq_(rhs.term_freq_),
     field_(std::move(rhs.field_)),
-    fst_(std::move(rhs.fst_)),
+    fst_(rhs.fst_.exchange(nullptr)),
+    fst_offset_(rhs.fst_offset_),
     owner_(rhs.owner_) {
   min_term_ref_ = min_term_;
   max_term_ref_ = max_term_;
@@ -1711,10 +1716,47 @@ term_reader::term_reader(term_reader&& rhs) noexcept
   rhs.doc_count_ = 0;
   rhs.doc_freq_ = 0;
   rhs.term_freq_ = 0;
-  rhs.fst_ = nullptr;
+  rhs.fst_offset_ = 0;
   rhs.owner_ = nullptr;
 }
 
+term_reader::~term_reader() {
+  delete fst_.load(std::memory_order_relaxed);
+}
+
+const term_reader::fst_t& term_reader::fst() const {
+  auto* fst = fst_.load(std::memory_order_acquire);
+
+  if (IRS_LIKELY(fst)) {
+    return *fst;
+  }
+
+  assert(owner_ && owner_->index_in_);
+  std::lock_guard<std::mutex> lock(owner_->fst_mutex_);
+
+  fst = fst_.load(std::memory_order_relaxed);
+
+  if (!fst) {
+    auto in = owner_->index_in_->reopen(); // thread-safe
+    in->seek(fst_offset_);
+
+    input_buf isb(in.get());
+    std::istream input(&isb); // wrap stream to be OpenFST compliant
+
+    fst = fst_t::Read(input, fst_read_options());
+
+    if (!fst) {
+      throw irs::index_error(string_utils::to_string(
+        "failed to read term index for field '%s'",
+        field_.name.c_str()));
+    }
+
+    fst_.store(fst, std::memory_order_release);
+  }
+
+  return *fst;
+}
+
 seek_term_iterator::ptr term_reader::iterator() const {
   return memory::make_managed<seek_term_iterator>(
     memory::make_unique<detail::term_iterator>(*this));
@@ -1728,7 +1770,8 @@ seek_term_iterator::ptr term_reader::iterator(automaton_table_matcher& matcher)
 void term_reader::prepare(
     std::istream& in, 
     const feature_map_t& feature_map,
-    field_reader& owner) {
+    field_reader& owner,
+    bool lazy_fst) {
   // read field metadata
   index_input& meta_in = *static_cast<input_buf*>(in.rdbuf());
   field_.name = read_string<std::string>(meta_in);
@@ -1749,16 +1792,24 @@ void term_reader::prepare(
     pfreq_ = &freq_;
   }
 
+  owner_ = &owner;
+
+  if (lazy_fst) {
+    // term index will be read on first access
+    fst_offset_ = meta_in.file_pointer();
+    return;
+  }
+
   // read FST
-  fst_.reset(fst_t::Read(in, fst_read_options()));
+  std::unique_ptr<fst_t> fst(fst_t::Read(in, fst_read_options()));
 
-  if (!fst_) {
+  if (!fst) {
     throw irs::index_error(string_utils::to_string(
       "failed to read term index for field '%s'",
       field_.name.c_str()));
   }
 
-  owner_ = &owner;
+  fst_.store(fst.release(), std::memory_order_relaxed);
 }
 
 attribute* term_reader::get_mutable(type_info::type_id type) noexcept {
@@ -1772,7 +1823,7 @@ attribute* term_reader::get_mutable(type_info::type_id type) noexcept {
 class term_reader_visitor {
  public:
   explicit term_reader_visitor(const term_reader& field)
-    : fst_(field.fst_.get()),
+    : fst_(&field.fst()),
       terms_in_(field.owner_->terms_in_->reopen()),
       terms_in_cipher_(field.owner_->terms_in_cipher_.get()) {
   }
@@ -2183,6 +2234,7 @@ void field_writer::prepare(const irs::flush_state& state) {
   suffix_.reset();
   term_count_ = 0;
   fields_count_ = 0;
+  fst_offsets_.clear();
 
   std::string filename;
   bstring enc_header;
@@ -2367,6 +2419,10 @@ void field_writer::end_field(
   std::ostream os(&isb);
   fst.Write(os, fst_write_options());
 
+  if (version_ >= FORMAT_FST_OFFSETS) {
+    fst_offsets_.emplace_back(index_out_->file_pointer());
+  }
+
   stack_.clear();
   ++fields_count_;
 }
@@ -2387,6 +2443,15 @@ void field_writer::end() {
     index_out_ = out.release();
   }
 
+  if (version_ >= FORMAT_FST_OFFSETS) {
+    // end offsets of fields term indices, written unencrypted
+    // right before the footer to allow skipping term indices
+    assert(fst_offsets_.size() == fields_count_);
+    for (const auto offset : fst_offsets_) {
+      index_out_->write_long(offset);
+    }
+  }
+
   index_out_->write_long(fields_count_);
   format_utils::write_footer(*index_out_);
   index_out_.reset(); // ensure stream is closed
@@ -2421,16 +2486,20 @@ void field_reader::prepare(
   // check index header 
   index_input::ptr index_in;
 
-  int64_t checksum = 0;
-
   const auto term_index_version = prepare_input(
     filename, index_in,
-    irs::IOAdvice::SEQUENTIAL | irs::IOAdvice::READONCE, state,
+    irs::IOAdvice::RANDOM, state,
     field_writer::TERMS_INDEX_EXT,
     field_writer::FORMAT_TERMS_INDEX,
     field_writer::FORMAT_MIN,
-    field_writer::FORMAT_MAX,
-    &checksum);
+    field_writer::FORMAT_MAX);
+
+  // term indices are loaded on demand
+  const bool lazy_fst = term_index_version >= field_writer::FORMAT_FST_OFFSETS;
+
+  // term indices of the fields which are never accessed are never read,
+  // verifying checksum of the entire file would defeat that
+  const int64_t checksum = lazy_fst ? 0 : format_utils::checksum(*index_in);
 
   constexpr const size_t FOOTER_LEN =
       sizeof(uint64_t) // fields count
@@ -2438,6 +2507,8 @@ void field_reader::prepare(
 
   // read total number of indexed fields
   size_t fields_count{ 0 };
+  size_t tail_length = FOOTER_LEN; // unencrypted part at the end of the stream
+  std::vector<uint64_t> fst_offsets;
   {
     const uint64_t ptr = index_in->file_pointer();
 
@@ -2445,8 +2516,30 @@ void field_reader::prepare(
 
     fields_count = index_in->read_long();
 
-    // check index checksum
-    format_utils::check_footer(*index_in, checksum);
+    if (lazy_fst) {
+      // perform cheap error detection which
+      // could recognize some forms of corruption
+      validate_footer(*index_in);
+    } else {
+      // check index checksum
+      format_utils::check_footer(*index_in, checksum);
+    }
+
+    if (lazy_fst) {
+      tail_length += fields_count*sizeof(uint64_t);
+
+      if (index_in->length() < tail_length) {
+        throw index_error(string_utils::to_string(
+          "invalid term index offsets in segment '%s'",
+          meta.name.c_str()));
+      }
+
+      index_in->seek(index_in->length() - tail_length);
+      fst_offsets.resize(fields_count);
+      for (auto& offset : fst_offsets) {
+        offset = index_in->read_long();
+      }
+    }
 
     index_in->seek(ptr);
   }
@@ -2466,7 +2559,7 @@ void field_reader::prepare(
         std::move(index_in),
         *index_in_cipher,
         blocks_in_buffer,
-        FOOTER_LEN);
+        tail_length);
     }
   }
 
@@ -2478,11 +2571,16 @@ void field_reader::prepare(
   // read terms for each indexed field
   fields_.reserve(fields_count);
   name_to_field_.reserve(fields_count);
-  while (fields_count) {
+  for (size_t i = 0; fields_count; ++i) {
     fields_.emplace_back();
     auto& field = fields_.back();
 
-    field.prepare(input, feature_map, *this);
+    field.prepare(input, feature_map, *this, lazy_fst);
+
+    if (lazy_fst) {
+      // skip term index, it will be loaded on first access
+      index_in->seek(fst_offsets[i]);
+    }
 
     const auto& name = field.meta().name;
     const auto res = name_to_field_.emplace(
@@ -2510,6 +2608,12 @@ void field_reader::prepare(
       meta.name.c_str()));
   }
 
+  if (lazy_fst) {
+    // keep term index input for on demand loading
+    index_in_cipher_ = std::move(index_in_cipher);
+    index_in_ = std::move(index_in);
+  }
+
   //-----------------------------------------------------------------
   // prepare terms input
   //-----------------------------------------------------------------
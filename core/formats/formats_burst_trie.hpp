@@ -23,7 +23,9 @@
 #ifndef IRESEARCH_FORMAT_BURST_TRIE_H
 #define IRESEARCH_FORMAT_BURST_TRIE_H
 
+#include <atomic>
 #include <list>
+#include <mutex>
 
 #include "formats.hpp"
 #include "formats_10_attributes.hpp"
@@ -239,8 +241,21 @@ class term_reader : public irs::term_reader,
 
   term_reader() = default;
   term_reader(term_reader&& rhs) noexcept;
-
-  void prepare(std::istream& in, const feature_map_t& features, field_reader& owner);
+  ~term_reader();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief read field metadata from a specified stream
+  /// @param lazy_fst do not read term index right away, but remember its
+  ///        offset and load it on first access instead
+  //////////////////////////////////////////////////////////////////////////////
+  void prepare(std::istream& in, const feature_map_t& features,
+               field_reader& owner, bool lazy_fst);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns term index, loads it on demand
+  /// @note thread-safe
+  //////////////////////////////////////////////////////////////////////////////
+  const fst_t& fst() const;
 
   virtual seek_term_iterator::ptr iterator() const override;
   virtual seek_term_iterator::ptr iterator(automaton_table_matcher& matcher) const override;
@@ -266,7 +281,8 @@ class term_reader : public irs::term_reader,
   frequency freq_; // total term freq
   frequency* pfreq_{};
   field_meta field_;
-  std::unique_ptr<fst_t> fst_; // TODO: use compact fst here!!!
+  mutable std::atomic<fst_t*> fst_{}; // TODO: use compact fst here!!!
+  uint64_t fst_offset_{}; // offset of the term index in the index stream
   field_reader* owner_;
 }; // term_reader
 
@@ -286,7 +302,9 @@ NS_END // detail
 class field_writer final : public irs::field_writer {
  public:
   static const int32_t FORMAT_MIN = 0;
-  static const int32_t FORMAT_MAX = 1;
+  static const int32_t FORMAT_ENCRYPTION = 1; // encrypted terms and term index
+  static const int32_t FORMAT_FST_OFFSETS = 2; // term index offsets in footer
+  static const int32_t FORMAT_MAX = FORMAT_FST_OFFSETS;
 
   static const uint32_t DEFAULT_MIN_BLOCK_SIZE = 25;
   static const uint32_t DEFAULT_MAX_BLOCK_SIZE = 48;
@@ -360,6 +378,7 @@ class field_writer final : public irs::field_writer {
   index_output::ptr index_out_; // output stream for indexes
   postings_writer::ptr pw_; // postings writer
   std::vector<detail::entry> stack_;
+  std::vector<uint64_t> fst_offsets_; // end offsets of fields term indices
   std::unique_ptr<detail::fst_buffer> fst_buf_; // pimpl buffer used for building FST for fields
   detail::volatile_byte_ref last_term_; // last pushed term
   std::vector<size_t> prefixes_;
@@ -390,6 +409,7 @@ class field_reader final : public irs::field_reader {
   virtual size_t size() const noexcept override;
 
  private:
+  friend class detail::term_reader;
   friend class detail::term_iterator_base;
   friend class detail::term_reader_visitor;
 
@@ -399,6 +419,9 @@ class field_reader final : public irs::field_reader {
   irs::postings_reader::ptr pr_;
   encryption::stream::ptr terms_in_cipher_;
   index_input::ptr terms_in_;
+  encryption::stream::ptr index_in_cipher_;
+  index_input::ptr index_in_; // term index input for on demand loading
+  std::mutex fst_mutex_; // guards on demand loading of term indices
 }; // field_reader
 
 NS_END // burst_trie
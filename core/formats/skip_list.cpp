@@ -344,20 +344,14 @@ void skip_reader::reset() {
   std::for_each(levels_.begin(), levels_.end(), reset);
 }
 
-void skip_reader::load_level(levels_t& levels, index_input::ptr&& stream, size_t step) {
-  assert(stream);
-
-  // read level length
-  const auto length = stream->read_vlong();
+/*static*/ uint64_t skip_reader::read_level_length(index_input& in) {
+  const auto length = in.read_vlong();
 
   if (!length) {
     throw index_error("while loading level, error: zero length");
   }
 
-  const auto begin = stream->file_pointer();
-  const auto end = begin + length;
-
-  levels.emplace_back(std::move(stream), step, begin, end); // load level
+  return length;
 }
 
 void skip_reader::prepare(index_input::ptr&& in, const read_f& read /* = nop */) {
@@ -371,21 +365,48 @@ void skip_reader::prepare(index_input::ptr&& in, const read_f& read /* = nop */)
     levels.reserve(max_levels);
 
     size_t step = skip_0_ * size_t(pow(skip_n_, --max_levels)); // skip step of the level
+    size_t cached = 0; // number of levels loaded into memory
+    bstring cache;
 
-    // load levels from n down to 1
+    // load levels from n down to 1, upper levels are much smaller than
+    // level 0 but are visited by every seek, keep them in memory
     for (; max_levels; --max_levels) {
-      load_level(levels, in->dup(), step);
+      const auto length = read_level_length(*in);
+      const auto begin = in->file_pointer();
+
+      if (cached == levels.size()
+          && cache.size() + length <= MAX_CACHED_LEVELS_SIZE) {
+        const auto offset = cache.size();
+        cache.resize(offset + length);
+
+        if (length != in->read_bytes(&cache[offset], length)) {
+          throw io_error("failed to read skip level");
+        }
 
-      // seek to the next level
-      in->seek(levels.back().end);
+        levels.emplace_back(nullptr, step, offset, offset + length);
+        ++cached;
+      } else {
+        levels.emplace_back(in->dup(), step, begin, begin + length);
+
+        // seek to the next level
+        in->seek(begin + length);
+      }
 
       step /= skip_n_;
     }
 
     // load 0 level
-    load_level(levels, std::move(in), skip_0_);
+    const auto length = read_level_length(*in);
+    const auto begin = in->file_pointer();
+    levels.emplace_back(std::move(in), skip_0_, begin, begin + length);
     levels.back().child = UNDEFINED;
 
+    // cached levels refer to 'cache_', which isn't modified till next prepare
+    cache_ = std::move(cache);
+    for (size_t i = 0; i < cached; ++i) {
+      levels[i].stream = index_input::make<bytes_ref_input>(cache_);
+    }
+
     levels_ = std::move(levels);
   }
 
@@ -134,6 +134,11 @@ class IRESEARCH_API skip_writer: util::noncopyable {
 ////////////////////////////////////////////////////////////////////////////////
 class IRESEARCH_API skip_reader: util::noncopyable {
  public:
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief max total size of upper skip levels kept in memory by a reader
+  //////////////////////////////////////////////////////////////////////////////
+  static constexpr size_t MAX_CACHED_LEVELS_SIZE = 1 << 16;
+
   //////////////////////////////////////////////////////////////////////////////
   /// @brief function will be called when reading of next skip 
   /// @param index of the level in a skip-list
@@ -170,6 +175,8 @@ class IRESEARCH_API skip_reader: util::noncopyable {
   /// @param max_levels maximum number of levels in a skip-list
   /// @param count total number of elements to store in a skip-list
   /// @param read read function
+  /// @note upper levels are loaded into memory, so that seeks read only
+  ///       the level 0 from the specified stream, see MAX_CACHED_LEVELS_SIZE
   //////////////////////////////////////////////////////////////////////////////
   void prepare(
     index_input::ptr&& in,
@@ -231,7 +238,7 @@ class IRESEARCH_API skip_reader: util::noncopyable {
 
   typedef std::vector<level> levels_t;
 
-  static void load_level(levels_t& levels, index_input::ptr&& stream, size_t step);
+  static uint64_t read_level_length(index_input& in);
   static doc_id_t nop(size_t, index_input&) { return doc_limits::invalid(); }
   static void seek_skip(skip_reader::level& level, uint64_t ptr, size_t skipped);
 
@@ -241,6 +248,7 @@ class IRESEARCH_API skip_reader: util::noncopyable {
   IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
   read_f read_;
   levels_t levels_; // input streams for skip-list levels
+  bstring cache_; // data of the upper levels loaded into memory
   size_t skip_0_; // skip interval for 0 level
   size_t skip_n_; // skip interval for 1..n levels
   IRESEARCH_API_PRIVATE_VARIABLES_END
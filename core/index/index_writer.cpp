@@ -1214,6 +1214,8 @@ index_writer::index_writer(
     const segment_options& segment_limits,
     const comparer* comparator,
     const column_info_provider_t& column_info,
+    rate_limiter::ptr flush_rate_limiter,
+    rate_limiter::ptr merge_rate_limiter,
     index_meta&& meta,
     committed_state_t&& committed_state)
   : column_info_(column_info),
@@ -1222,6 +1224,8 @@ index_writer::index_writer(
     codec_(codec),
     committed_state_(std::move(committed_state)),
     dir_(dir),
+    flush_dir_(dir, std::move(flush_rate_limiter)),
+    merge_dir_(dir, std::move(merge_rate_limiter)),
     flush_context_pool_(2), // 2 because just swap them due to common commit lock
     meta_(std::move(meta)),
     segment_limits_(segment_limits),
@@ -1369,6 +1373,8 @@ index_writer::ptr index_writer::make(
     segment_options(opts),
     opts.comparator,
     opts.column_info ? opts.column_info : DEFAULT_COLUMN_INFO,
+    opts.flush_rate_limiter,
+    opts.merge_rate_limiter,
     std::move(meta),
     std::move(comitted_state)
   );
@@ -1506,7 +1512,7 @@ bool index_writer::consolidate(
   consolidation_segment.meta.version = 0; // reset version for new segment
   consolidation_segment.meta.name = file_name(meta_.increment()); // increment active meta, not fn arg
 
-  ref_tracking_directory dir(dir_); // track references for new segment
+  ref_tracking_directory dir(merge_dir_); // track references for new segment
   merge_writer merger(dir, column_info_, comparator_);
   merger.reserve(candidates.size());
 
@@ -1696,7 +1702,7 @@ bool index_writer::import(
     codec = codec_;
   }
 
-  ref_tracking_directory dir(dir_); // track references
+  ref_tracking_directory dir(merge_dir_); // track references
 
   index_meta::index_segment_t segment;
   segment.meta.name = file_name(meta_.increment());
@@ -1827,7 +1833,7 @@ index_writer::active_segment_context index_writer::get_segment_context(
     return segment_meta(file_name(meta_.increment()), codec_);
   };
   auto segment_ctx = segment_writer_pool_.emplace(
-    dir_, std::move(meta_generator),
+    flush_dir_, std::move(meta_generator),
     column_info_, comparator_
   ).release();
   auto segment_memory_max = segment_limits_.segment_memory_max.load();
@@ -36,6 +36,7 @@
 
 #include "utils/async_utils.hpp"
 #include "utils/bitvector.hpp"
+#include "utils/directory_utils.hpp"
 #include "utils/thread_utils.hpp"
 #include "utils/object_pool.hpp"
 #include "utils/string.hpp"
@@ -219,6 +220,87 @@ class IRESEARCH_API index_writer
       );
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief insert a range of documents filled by the specified functor,
+    ///        the segment is acquired and reserved once for the whole range
+    ///        rather than once per document
+    /// @param begin the first document of the range
+    /// @param end the end of the range
+    /// @param func the insertion logic, similar in signature to e.g.:
+    ///        std::function<void(segment_writer::document&, decltype(*begin))>
+    /// @note the changes are not visible until commit()
+    /// @note a document that fails to be inserted is masked as removed
+    ///       without affecting the rest of the range, same as for insert()
+    /// @return the end of the inserted part of the range, if != end then
+    ///         the segment is full and the rest of the range should be
+    ///         passed to a subsequent call
+    ////////////////////////////////////////////////////////////////////////////
+    template<typename Iterator, typename Func>
+    Iterator insert(Iterator begin, Iterator end, Func func) {
+      if (begin == end) {
+        return begin;
+      }
+
+      flush_context* ctx;
+      segment_context_ptr segment;
+
+      {
+        // thread-safe to use ctx_/segment_ while have lock since active flush_context will not change
+        auto ctx_ptr = update_segment(); // updates 'segment_' and 'ctx_'
+
+        assert(ctx_ptr);
+        assert(segment_.ctx());
+        assert(segment_.ctx()->writer_);
+        ctx = ctx_ptr.get(); // make copies in case 'func' causes their reload
+        segment = segment_.ctx(); // make copies in case 'func' causes their reload
+        ++segment->active_count_;
+      }
+
+      auto clear_busy = make_finally([ctx, segment]()->void {
+        if (!--segment->active_count_) {
+          SCOPED_LOCK(ctx->mutex_); // lock due to context modification and notification
+          ctx->pending_segment_context_cond_.notify_all(); // in case ctx is in flush_all()
+        }
+      });
+      auto& writer = *(segment->writer_);
+      segment_writer::document doc(writer);
+      const auto update = segment->make_update_context();
+      const auto segment_docs_max = writer_.segment_limits_.segment_docs_max.load();
+      const auto segment_memory_max = writer_.segment_limits_.segment_memory_max.load();
+      auto uncomitted_doc_id_begin =
+        segment->uncomitted_doc_id_begin_ > segment->flushed_update_contexts_.size()
+        ? (segment->uncomitted_doc_id_begin_ - segment->flushed_update_contexts_.size()) // uncomitted start in 'writer_'
+        : doc_limits::min() // uncommited start in 'flushed_'
+        ;
+
+      do {
+        assert(uncomitted_doc_id_begin <= writer.docs_cached() + doc_limits::min());
+        auto rollback_extra =
+          writer.docs_cached() + doc_limits::min() - uncomitted_doc_id_begin; // ensure reset() will be noexcept
+
+        if (integer_traits<doc_id_t>::const_max <= writer.docs_cached() + doc_limits::min()
+            || doc_limits::eof(writer.begin(update, rollback_extra))) {
+          break; // the segment cannot fit any more docs
+        }
+
+        segment->buffered_docs_.store(writer.docs_cached());
+
+        try {
+          func(doc, *begin);
+        } catch (...) {
+          writer.rollback(); // mark as failed
+          throw;
+        }
+
+        writer.commit(); // rolls back an invalid document
+        ++begin;
+      } while (begin != end
+               && (!segment_docs_max || segment_docs_max > writer.docs_cached()) // too many docs
+               && (!segment_memory_max || segment_memory_max > writer.memory_active())); // too much memory
+
+      return begin;
+    }
+
     ////////////////////////////////////////////////////////////////////////////
     /// @brief marks all documents matching the filter for removal
     /// @param filter the filter selecting which documents should be removed
@@ -455,6 +537,19 @@ class IRESEARCH_API index_writer
     ////////////////////////////////////////////////////////////////////////////
     size_t segment_pool_size{128}; // arbitrary size
 
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief paces writes of segment flushes, may be shared between writers
+    ///        nullptr == unlimited
+    ////////////////////////////////////////////////////////////////////////////
+    rate_limiter::ptr flush_rate_limiter;
+
+    ////////////////////////////////////////////////////////////////////////////
+    /// @brief paces writes of consolidations and imports, may be shared
+    ///        between writers
+    ///        nullptr == unlimited
+    ////////////////////////////////////////////////////////////////////////////
+    rate_limiter::ptr merge_rate_limiter;
+
     ////////////////////////////////////////////////////////////////////////////
     /// @brief aquire an exclusive lock on the repository to guard against index
     ///        corruption from multiple index_writers
@@ -1021,6 +1116,8 @@ class IRESEARCH_API index_writer
     const segment_options& segment_limits,
     const comparer* comparator,
     const column_info_provider_t& column_info,
+    rate_limiter::ptr flush_rate_limiter,
+    rate_limiter::ptr merge_rate_limiter,
     index_meta&& meta,
     committed_state_t&& committed_state
   );
@@ -1044,6 +1141,8 @@ class IRESEARCH_API index_writer
   std::recursive_mutex consolidation_lock_;
   consolidating_segments_t consolidating_segments_; // segments that are under consolidation
   directory& dir_; // directory used for initialization of readers
+  rate_limited_directory flush_dir_; // directory used for flushing segments
+  rate_limited_directory merge_dir_; // directory used for consolidation/import
   std::vector<flush_context> flush_context_pool_; // collection of contexts that collect data to be flushed, 2 because just swap them
   std::atomic<flush_context*> flush_context_; // currently active context accumulating data to be processed during the next flush
   index_meta meta_; // latest/active state of index metadata
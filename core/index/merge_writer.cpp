@@ -34,6 +34,7 @@
 #include "utils/directory_utils.hpp"
 #include "utils/log.hpp"
 #include "utils/lz4compression.hpp"
+#include "utils/timer_utils.hpp"
 #include "utils/type_limits.hpp"
 #include "utils/version_utils.hpp"
 #include "store/store_utils.hpp"
@@ -1647,6 +1648,7 @@ bool merge_writer::flush(
     const flush_progress_t& progress /*= {}*/
 ) {
   REGISTER_TIMER_DETAILED();
+  timer_utils::scoped_metric metric(timer_utils::metric::SEGMENT_MERGE);
   assert(segment.meta.codec); // must be set outside
 
   bool result = false; // overall flush result
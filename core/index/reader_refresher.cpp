@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "reader_refresher.hpp"
+
+#include "segment_reader.hpp"
+#include "utils/log.hpp"
+
+NS_ROOT
+
+reader_refresher::reader_refresher(const directory_reader& reader)
+  : reader_refresher(reader, options()) {
+}
+
+reader_refresher::reader_refresher(
+    const directory_reader& reader,
+    options&& opts)
+  : opts_(std::move(opts)),
+    reader_(reader),
+    pool_(1, 0) {
+}
+
+reader_refresher::~reader_refresher() {
+  pool_.stop(); // finish pending refresh
+}
+
+bool reader_refresher::refresh() {
+  std::lock_guard<std::mutex> lock(refresh_mutex_);
+
+  const auto current = reader();
+  auto reader = current.reopen(opts_.codec);
+
+  if (reader == current) {
+    return false; // nothing changed
+  }
+
+  // segments reused from 'current' are already warm, so that
+  // only new segments pay for loading their data here
+  warmup(reader);
+
+  reader_ = reader; // publish
+
+  return true;
+}
+
+bool reader_refresher::refresh_async() {
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+
+    if (pending_) {
+      return false;
+    }
+
+    pending_ = true;
+  }
+
+  auto task = [this]() noexcept {
+    try {
+      refresh();
+    } catch (const std::exception& e) {
+      IR_FRMT_ERROR(
+        "caught exception while refreshing reader, error '%s'", e.what());
+      IR_LOG_EXCEPTION();
+    } catch (...) {
+      IR_FRMT_ERROR("caught exception while refreshing reader");
+      IR_LOG_EXCEPTION();
+    }
+
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    pending_ = false;
+    pending_cond_.notify_all();
+  };
+
+  if (!pool_.run(std::move(task))) {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    pending_ = false;
+    pending_cond_.notify_all();
+    return false;
+  }
+
+  return true;
+}
+
+void reader_refresher::wait() {
+  std::unique_lock<std::mutex> lock(pending_mutex_);
+  pending_cond_.wait(lock, [this]() { return !pending_; });
+}
+
+void reader_refresher::warmup(const directory_reader& reader) const {
+  if (!opts_.fields.empty()) {
+    const std::vector<string_ref> fields(
+      opts_.fields.begin(), opts_.fields.end());
+
+    for (auto& segment : reader) {
+#ifdef IRESEARCH_DEBUG
+      dynamic_cast<const segment_reader&>(segment).warmup(fields);
+#else
+      static_cast<const segment_reader&>(segment).warmup(fields);
+#endif
+    }
+  }
+
+  if (opts_.warmup) {
+    opts_.warmup(reader);
+  }
+}
+
+NS_END
@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_READER_REFRESHER_H
+#define IRESEARCH_READER_REFRESHER_H
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+#include "directory_reader.hpp"
+#include "utils/async_utils.hpp"
+#include "utils/noncopyable.hpp"
+
+NS_ROOT
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class reader_refresher
+/// @brief keeps an up to date 'directory_reader', a new reader is opened and
+///        warmed up (term dictionaries, columnstore, user queries) before it
+///        gets published, so that queries never pay for the lazy loading of
+///        the recently flushed/merged segments
+////////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API reader_refresher : private util::noncopyable {
+ public:
+  typedef std::function<void(const directory_reader&)> warmup_f;
+
+  struct options {
+    // codec to use for reopen, nullptr - the latest file for all known codecs
+    format::ptr codec;
+
+    // fields to load term dictionaries and columnstore for
+    std::vector<std::string> fields;
+
+    // custom warm-up routine, e.g. a set of representative queries,
+    // invoked before a reader is published
+    warmup_f warmup;
+  };
+
+  explicit reader_refresher(const directory_reader& reader);
+  reader_refresher(const directory_reader& reader, options&& opts);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @note waits for a pending background refresh
+  //////////////////////////////////////////////////////////////////////////////
+  ~reader_refresher();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns the most recently published reader, may be called from any
+  ///          thread concurrently with 'refresh(...)'
+  //////////////////////////////////////////////////////////////////////////////
+  directory_reader reader() const noexcept {
+    return reader_; // atomic copy
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief reopens, warms up and publishes a new reader in the calling thread
+  /// @returns true if a new reader has been published
+  //////////////////////////////////////////////////////////////////////////////
+  bool refresh();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief schedules 'refresh()' to be run in a background thread, requests
+  ///        submitted while a refresh is still pending are coalesced
+  /// @returns false if a refresh is already pending
+  /// @note errors of a background refresh are logged, the previously
+  ///       published reader remains active
+  //////////////////////////////////////////////////////////////////////////////
+  bool refresh_async();
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief blocks until a pending background refresh is finished
+  //////////////////////////////////////////////////////////////////////////////
+  void wait();
+
+ private:
+  void warmup(const directory_reader& reader) const;
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  options opts_;
+  directory_reader reader_;
+  std::mutex refresh_mutex_; // serializes refreshes
+  std::mutex pending_mutex_;
+  std::condition_variable pending_cond_;
+  bool pending_{false};
+  async_utils::thread_pool pool_;
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // reader_refresher
+
+NS_END
+
+#endif // IRESEARCH_READER_REFRESHER_H
@@ -33,6 +33,8 @@
 #include "utils/singleton.hpp"
 #include "utils/type_limits.hpp"
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 NS_LOCAL
@@ -233,6 +235,11 @@ NS_ROOT
 // segment_reader
 // -------------------------------------------------------------------
 
+////////////////////////////////////////////////////////////////////////////////
+/// @note term dictionaries, columnstore and columns metadata are loaded on
+///       first access unless the segment is sorted (sort column is needed
+///       right away) or explicitly warmed up
+////////////////////////////////////////////////////////////////////////////////
 class segment_reader_impl : public sub_reader {
  public:
   static sub_reader::ptr open(
@@ -244,6 +251,8 @@ class segment_reader_impl : public sub_reader {
     return dir_;
   }
 
+  void warmup(const std::vector<string_ref>& fields) const;
+
   virtual const column_meta* column(const string_ref& name) const override;
 
   virtual column_iterator::ptr columns() const override;
@@ -304,21 +313,33 @@ class segment_reader_impl : public sub_reader {
 
  private:
   DECLARE_SHARED_PTR(segment_reader_impl); // required for NAMED_PTR(...)
-  std::vector<column_meta> columns_;
-  columnstore_reader::ptr columnstore_reader_;
+
+  // ensures columnstore and columns metadata are loaded
+  void load_columns() const {
+    if (!columns_loaded_.load(std::memory_order_acquire)) {
+      load_columns_slow();
+    }
+  }
+
+  void load_columns_slow() const;
+
+  mutable std::vector<column_meta> columns_;
+  mutable columnstore_reader::ptr columnstore_reader_;
   const columnstore_reader::column_reader* sort_{};
   const directory& dir_;
   uint64_t docs_count_;
   document_mask docs_mask_;
   field_reader::ptr field_reader_;
-  std::vector<column_meta*> id_to_column_;
+  mutable std::vector<column_meta*> id_to_column_;
   uint64_t meta_version_;
-  std::unordered_map<hashed_string_ref, column_meta*> name_to_column_;
+  mutable std::unordered_map<hashed_string_ref, column_meta*> name_to_column_;
+  segment_meta meta_; // required for loading columns on demand
+  mutable std::mutex columns_mutex_;
+  mutable std::atomic<bool> columns_loaded_{ false };
 
   segment_reader_impl(
     const directory& dir,
-    uint64_t meta_version,
-    uint64_t docs_count
+    const segment_meta& meta
   );
 };
 
@@ -361,6 +382,19 @@ template<>
   return segment_reader_impl::open(dir, meta);
 }
 
+void segment_reader::warmup(const std::vector<string_ref>& fields) const {
+  // make a copy
+  impl_ptr impl = atomic_utils::atomic_load(&impl_);
+
+#ifdef IRESEARCH_DEBUG
+  auto& reader_impl = dynamic_cast<const segment_reader_impl&>(*impl);
+#else
+  auto& reader_impl = static_cast<const segment_reader_impl&>(*impl);
+#endif
+
+  reader_impl.warmup(fields);
+}
+
 segment_reader segment_reader::reopen(const segment_meta& meta) const {
   // make a copy
   impl_ptr impl = atomic_utils::atomic_load(&impl_);
@@ -383,20 +417,83 @@ segment_reader segment_reader::reopen(const segment_meta& meta) const {
 
 segment_reader_impl::segment_reader_impl(
     const directory& dir,
-    uint64_t meta_version,
-    uint64_t docs_count)
+    const segment_meta& meta)
   : dir_(dir),
-    docs_count_(docs_count),
-    meta_version_(meta_version) {
+    docs_count_(meta.docs_count),
+    meta_version_(meta.version),
+    meta_(meta) {
+}
+
+void segment_reader_impl::load_columns_slow() const {
+  std::lock_guard<std::mutex> lock(columns_mutex_);
+
+  if (columns_loaded_.load(std::memory_order_relaxed)) {
+    return; // already loaded by another thread
+  }
+
+  auto& codec = *meta_.codec;
+
+  // initialize optional columnstore
+  if (!columnstore_reader_ && segment_reader::has<irs::columnstore_reader>(meta_)) {
+    auto columnstore_reader = codec.get_columnstore_reader();
+
+    if (!columnstore_reader->prepare(dir_, meta_)) {
+      throw index_error(string_utils::to_string(
+        "failed to find existing (according to meta) columnstore in segment '%s'",
+        meta_.name.c_str()
+      ));
+    }
+
+    columnstore_reader_ = std::move(columnstore_reader);
+  }
+
+  // initialize optional columns meta
+  std::vector<column_meta> columns;
+  std::vector<column_meta*> id_to_column;
+  std::unordered_map<hashed_string_ref, column_meta*> name_to_column;
+
+  read_columns_meta(
+    codec,
+    dir_,
+    meta_,
+    columns,
+    id_to_column,
+    name_to_column
+  );
+
+  // nothrow block, moving containers retains addresses of the elements
+  columns_ = std::move(columns);
+  id_to_column_ = std::move(id_to_column);
+  name_to_column_ = std::move(name_to_column);
+
+  columns_loaded_.store(true, std::memory_order_release);
+}
+
+void segment_reader_impl::warmup(const std::vector<string_ref>& fields) const {
+  load_columns();
+
+  for (auto& name : fields) {
+    const auto* field = field_reader_->field(name);
+
+    if (field) {
+      // positioning iterator at the first term forces
+      // loading of the term index and the root block
+      field->iterator()->next();
+    }
+  }
 }
 
 const column_meta* segment_reader_impl::column(
     const string_ref& name) const {
+  load_columns();
+
   auto it = name_to_column_.find(make_hashed_ref(name));
   return it == name_to_column_.end() ? nullptr : it->second;
 }
 
 column_iterator::ptr segment_reader_impl::columns() const {
+  load_columns();
+
   struct less {
     bool operator()(
         const irs::column_meta& lhs,
@@ -433,7 +530,7 @@ doc_iterator::ptr segment_reader_impl::docs_iterator() const {
     const directory& dir, const segment_meta& meta) {
   auto& codec = *meta.codec;
 
-  PTR_NAMED(segment_reader_impl, reader, dir, meta.version, meta.docs_count);
+  PTR_NAMED(segment_reader_impl, reader, dir, meta);
 
   // read document mask
   index_utils::read_document_mask(reader->docs_mask_, dir, meta);
@@ -443,45 +540,29 @@ doc_iterator::ptr segment_reader_impl::docs_iterator() const {
   field_reader = codec.get_field_reader();
   field_reader->prepare(dir, meta, reader->docs_mask_);
 
-  // initialize optional columnstore
-  if (segment_reader::has<irs::columnstore_reader>(meta)) {
-    auto& columnstore_reader = reader->columnstore_reader_;
-    columnstore_reader  = codec.get_columnstore_reader();
+  // columnstore and columns meta are loaded on demand unless
+  // the segment is sorted and the sort column is required right away
+  if (segment_reader::has<irs::columnstore_reader>(meta)
+      && field_limits::valid(meta.sort)) {
+    reader->load_columns();
+
+    reader->sort_ = reader->columnstore_reader_->column(meta.sort);
 
-    if (!columnstore_reader->prepare(dir, meta)) {
+    if (!reader->sort_) {
       throw index_error(string_utils::to_string(
-        "failed to find existing (according to meta) columnstore in segment '%s'",
-        meta.name.c_str()
+        "failed to find sort column '" IR_UINT64_T_SPECIFIER "' (according to meta) in columnstore in segment '%s'",
+        meta.sort, meta.name.c_str()
       ));
     }
-
-    if (field_limits::valid(meta.sort)) {
-      reader->sort_ = columnstore_reader->column(meta.sort);
-
-      if (!reader->sort_) {
-        throw index_error(string_utils::to_string(
-          "failed to find sort column '" IR_UINT64_T_SPECIFIER "' (according to meta) in columnstore in segment '%s'",
-          meta.sort, meta.name.c_str()
-        ));
-      }
-    }
   }
 
-  // initialize optional columns meta
-  read_columns_meta(
-    codec,
-    dir,
-    meta,
-    reader->columns_,
-    reader->id_to_column_,
-    reader->name_to_column_
-  );
-
   return reader;
 }
 
 const columnstore_reader::column_reader* segment_reader_impl::column_reader(
     field_id field) const {
+  load_columns();
+
   return columnstore_reader_
     ? columnstore_reader_->column(field)
     : nullptr;
@@ -106,6 +106,12 @@ class IRESEARCH_API segment_reader final
 
   segment_reader reopen(const segment_meta& meta) const;
 
+  ////////////////////////////////////////////////////////////////////////////////
+  /// @brief loads columns metadata and term dictionaries of the specified
+  ///        fields which are otherwise loaded on first access
+  ////////////////////////////////////////////////////////////////////////////////
+  void warmup(const std::vector<string_ref>& fields) const;
+
   void reset() noexcept {
     impl_.reset();
   }
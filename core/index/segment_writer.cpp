@@ -25,8 +25,10 @@
 #include "segment_writer.hpp"
 #include "store/store_utils.hpp"
 #include "index_meta.hpp"
+#include "segment_reader.hpp"
 #include "analysis/token_stream.hpp"
 #include "analysis/token_attributes.hpp"
+#include "store/memory_directory.hpp"
 #include "utils/index_utils.hpp"
 #include "utils/log.hpp"
 #include "utils/lz4compression.hpp"
@@ -258,7 +260,9 @@ void segment_writer::flush_fields(const doc_map& docmap) {
   }
 }
 
-size_t segment_writer::flush_doc_mask(const segment_meta &meta) {
+size_t segment_writer::flush_doc_mask(
+    directory& dir,
+    const segment_meta& meta) {
   document_mask docs_mask;
   docs_mask.reserve(docs_mask_.size());
 
@@ -272,13 +276,14 @@ size_t segment_writer::flush_doc_mask(const segment_meta &meta) {
   }
 
   auto writer = meta.codec->get_document_mask_writer();
-  writer->write(dir_, meta, docs_mask);
+  writer->write(dir, meta, docs_mask);
 
   return docs_mask.size();
 }
 
 void segment_writer::flush(index_meta::index_segment_t& segment) {
   REGISTER_TIMER_DETAILED();
+  timer_utils::scoped_metric metric(timer_utils::metric::SEGMENT_FLUSH);
 
   auto& meta = segment.meta;
 
@@ -321,7 +326,7 @@ void segment_writer::flush(index_meta::index_segment_t& segment) {
   // write non-empty document mask
   size_t docs_mask_count = 0;
   if (docs_mask_.any()) {
-    docs_mask_count = flush_doc_mask(meta);
+    docs_mask_count = flush_doc_mask(dir_, meta);
   }
 
   // update segment metadata
@@ -335,6 +340,48 @@ void segment_writer::flush(index_meta::index_segment_t& segment) {
   index_utils::flush_index_segment(dir_, segment);
 }
 
+sub_reader::ptr segment_writer::snapshot(const format::ptr& codec) {
+  REGISTER_TIMER_DETAILED();
+  assert(codec);
+
+  if (!docs_cached()) {
+    return sub_reader::ptr(sub_reader::ptr(), &sub_reader::empty()); // aliasing ctor
+  }
+
+  struct snapshot_t {
+    memory_directory dir;
+    segment_reader reader;
+  };
+
+  auto snapshot = memory::make_shared<snapshot_t>();
+
+  segment_meta meta(seg_name_, codec);
+  meta.docs_count = docs_cached();
+
+  // segment isn't sorted yet, documents keep the order of insertion
+  flush_state state;
+  state.dir = &snapshot->dir;
+  state.doc_count = docs_cached();
+  state.name = seg_name_;
+  state.docmap = nullptr;
+
+  auto field_writer = codec->get_field_writer(false);
+  assert(field_writer);
+  fields_.flush(*field_writer, state);
+
+  size_t docs_mask_count = 0;
+  if (docs_mask_.any()) {
+    docs_mask_count = flush_doc_mask(snapshot->dir, meta);
+  }
+
+  assert(meta.docs_count >= docs_mask_count);
+  meta.live_docs_count = meta.docs_count - docs_mask_count;
+
+  snapshot->reader = segment_reader::open(snapshot->dir, meta);
+
+  return sub_reader::ptr(snapshot, &snapshot->reader); // aliasing ctor
+}
+
 void segment_writer::reset() noexcept {
   initialized_ = false;
   tick_ = 0;
@@ -26,6 +26,7 @@
 
 #include "column_info.hpp"
 #include "field_data.hpp"
+#include "index_reader.hpp"
 #include "sorted_column.hpp"
 #include "analysis/token_stream.hpp"
 #include "formats/formats.hpp"
@@ -214,6 +215,18 @@ class IRESEARCH_API segment_writer: util::noncopyable {
 
   void flush(index_meta::index_segment_t& segment);
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief encodes inverted data of the documents buffered so far into a
+  ///        private in-memory directory and opens it as a standalone segment,
+  ///        so that buffered documents become searchable without a flush
+  /// @param codec the codec to encode inverted data with
+  /// @returns reader over the buffered documents, document ids are the ones
+  ///          returned by 'begin(...)', removed documents are masked
+  /// @note stored columns and norms are not part of the snapshot
+  /// @note must not be called concurrently with document insertion
+  //////////////////////////////////////////////////////////////////////////////
+  sub_reader::ptr snapshot(const format::ptr& codec);
+
   const std::string& name() const noexcept { return seg_name_; }
   size_t docs_cached() const noexcept { return docs_context_.size(); }
   bool initialized() const noexcept { return initialized_; }
@@ -379,7 +392,7 @@ class IRESEARCH_API segment_writer: util::noncopyable {
 
   void finish(); // finishes document
 
-  size_t flush_doc_mask(const segment_meta& meta); // flushes document mask to directory, returns number of masked documens
+  size_t flush_doc_mask(directory& dir, const segment_meta& meta); // flushes document mask to directory, returns number of masked documens
   void flush_column_meta(const segment_meta& meta); // flushes column meta to directory
   void flush_fields(const doc_map& docmap); // flushes indexed fields to directory
 
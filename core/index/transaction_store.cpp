@@ -888,7 +888,8 @@ class transaction_store::store_reader_helper {
  public:
   ////////////////////////////////////////////////////////////////////////////////
   /// @brief fill reader state only for the specified documents
-  /// @note caller must have read lock on store.mutex_
+  /// @note caller must have read lock on store.mutex_, entries of columns and
+  ///       terms of fields are read under their own locks
   ////////////////////////////////////////////////////////////////////////////////
   static size_t get_reader_state_unsafe(
       store_reader_impl::fields_t& fields,
@@ -906,9 +907,13 @@ class transaction_store::store_reader_helper {
       store_reader_impl::document_entries_t entries;
 
       // copy over valid documents
-      for (auto& entry: columns_entry.second.entries_) {
-        if (entry.buf_ && documents.test(entry.doc_id_)) {
-          entries.emplace_back(entry);
+      {
+        SCOPED_LOCK(columns_entry.second.mutex_);
+
+        for (auto& entry: columns_entry.second.entries_) {
+          if (entry.buf_ && documents.test(entry.doc_id_)) {
+            entries.emplace_back(entry);
+          }
         }
       }
 
@@ -929,9 +934,13 @@ class transaction_store::store_reader_helper {
       store_reader_impl::document_entries_t entries;
 
       // copy over valid documents
-      for (auto& entry: columns_entry.second.entries_) {
-        if (entry.buf_ && documents.test(entry.doc_id_)) {
-          entries.emplace_back(entry);
+      {
+        SCOPED_LOCK(columns_entry.second.mutex_);
+
+        for (auto& entry: columns_entry.second.entries_) {
+          if (entry.buf_ && documents.test(entry.doc_id_)) {
+            entries.emplace_back(entry);
+          }
         }
       }
 
@@ -953,35 +962,39 @@ class transaction_store::store_reader_helper {
       store_reader_impl::term_reader_t terms(field_entry.second.meta_);
 
       // copy over non-empty terms into an ordered map
-      for (auto& term_entry: field_entry.second.terms_) {
-        store_reader_impl::document_entries_t postings;
-
-        // copy over valid postings
-        for (auto& entry: term_entry.second.entries_) {
-          if (entry.buf_ && documents.test(entry.doc_id_)) {
-            field_docs.set(entry.doc_id_);
-            postings.emplace_back(entry);
+      for (auto& shard: field_entry.second.shards_) {
+        SCOPED_LOCK(shard.mutex_);
+
+        for (auto& term_entry: shard.terms_) {
+          store_reader_impl::document_entries_t postings;
+
+          // copy over valid postings
+          for (auto& entry: term_entry.second.entries_) {
+            if (entry.buf_ && documents.test(entry.doc_id_)) {
+              field_docs.set(entry.doc_id_);
+              postings.emplace_back(entry);
+            }
           }
-        }
 
-        if (postings.empty()) {
-          continue; // no docs in term, skip
-        }
+          if (postings.empty()) {
+            continue; // no docs in term, skip
+          }
 
-        std::sort(postings.begin(), postings.end(), DOC_LESS); // sort by doc_id
+          std::sort(postings.begin(), postings.end(), DOC_LESS); // sort by doc_id
 
-        auto& term = terms.terms_.emplace(
-          std::piecewise_construct,
-          std::forward_as_tuple(term_entry.first), // key
-          std::forward_as_tuple(term_entry.second.name_, term_entry.second.meta_, std::move(postings)) // value
-        ).first->first;
+          auto& term = terms.terms_.emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(term_entry.first), // key
+            std::forward_as_tuple(term_entry.second.name_, term_entry.second.meta_, std::move(postings)) // value
+          ).first->first;
 
-        if (terms.min_term_.null() || terms.min_term_ > term) {
-          terms.min_term_ = term; // point at term in reader map
-        }
+          if (terms.min_term_.null() || terms.min_term_ > term) {
+            terms.min_term_ = term; // point at term in reader map
+          }
 
-        if (terms.max_term_.null() || terms.max_term_ < term) {
-          terms.max_term_ = term; // point at term in reader map
+          if (terms.max_term_.null() || terms.max_term_ < term) {
+            terms.max_term_ = term; // point at term in reader map
+          }
         }
       }
 
@@ -1030,13 +1043,8 @@ store_reader store_reader::reopen() const {
     auto& reader_impl = static_cast<const store_reader_impl&>(*impl);
   #endif
 
-  {
-    async_utils::read_write_mutex::read_mutex mutex(reader_impl.store_.mutex_);
-    SCOPED_LOCK(mutex);
-
-    if (reader_impl.store_.generation_ == reader_impl.generation_) {
-      return store_reader(std::move(impl)); // reuse same reader since there were no changes in store
-    }
+  if (reader_impl.store_.generation_.load() == reader_impl.generation_) {
+    return store_reader(std::move(impl)); // reuse same reader since there were no changes in store
   }
 
   return reader_impl.store_.reader(); // store changed, create new reader
@@ -1054,8 +1062,8 @@ void store_writer::bstring_output::write(const byte_type* value, size_t size) {
 
 store_writer::store_writer(transaction_store& store) noexcept
   : next_doc_id_(type_limits<type_t::doc_id_t>::min()), store_(store) {
-  async_utils::read_write_mutex::write_mutex mutex(store_.mutex_);
-  SCOPED_LOCK(mutex);
+  async_utils::read_write_mutex::read_mutex mutex(store_.mutex_);
+  SCOPED_LOCK(mutex); // 'store_.reusable_' is replaced under write lock only
   const_cast<transaction_store::reusable_t&>(reusable_) = store.reusable_; // init under lock
 }
 
@@ -1265,19 +1273,20 @@ bool store_writer::index(
         return value.name_ ? hashed_bytes_ref(key.hash(), *(value.name_)) : key;
       };
 
-      async_utils::read_write_mutex::write_mutex mutex(store_.mutex_);
-      SCOPED_LOCK(mutex);
+      const auto term_name = make_hashed_ref(term->value(), std::hash<irs::bytes_ref>());
+      auto& shard = field->shard(term_name.hash());
+      SCOPED_LOCK(shard.mutex_); // 'field' is referenced, no need to lock 'store_.mutex_'
       auto field_term_itr = map_utils::try_emplace_update_key(
-        field->terms_,
+        shard.terms_,
         generator,
-        make_hashed_ref(term->value(), std::hash<irs::bytes_ref>()), // key
+        term_name, // key
         store_.bstring_pool_, term->value() // value
       );
       auto& field_term = field_term_itr.first->second;
 
       // new term was inserted which failed to initialize its buffer
       if (field_term_itr.second && !field_term.name_) {
-        field->terms_.erase(field_term_itr.first);
+        shard.terms_.erase(field_term_itr.first);
         IR_FRMT_ERROR(
           "failed to allocate buffer for term name while indexing new term: %s",
           std::string(ref_cast<char>(term->value()).c_str(), term->value().size()).c_str()
@@ -1444,8 +1453,7 @@ bool store_writer::store(
   // if this is the first time this column was seen for this document
   if (irs::integer_traits<size_t>::const_max == column_state_offset) {
     {
-      async_utils::read_write_mutex::write_mutex mutex(store_.mutex_);
-      SCOPED_LOCK(mutex);
+      SCOPED_LOCK(column->mutex_); // 'column' is referenced, no need to lock 'store_.mutex_'
       column->entries_.emplace_back(doc, out.file_pointer()); // column offset in buffer
     }
 
@@ -1513,22 +1521,26 @@ void transaction_store::cleanup() {
   // remove unused records from named user columns
   for (auto itr = columns_named_.begin(), end = columns_named_.end(); itr != end;) {
     auto& column = itr->second;
-    size_t last = column.entries_.size() - 1;
 
-    for (auto i = column.entries_.size(); i;) {
-      auto& record = column.entries_[--i];
+    {
+      SCOPED_LOCK(column.mutex_); // writers may append to a referenced column
+      size_t last = column.entries_.size() - 1;
 
-      if (used_doc_ids_.test(record.doc_id_)) {
-        continue; // record still in use
-      }
+      for (auto i = column.entries_.size(); i;) {
+        auto& record = column.entries_[--i];
 
-      record = std::move(column.entries_[last--]); // replace unused record
-      column.entries_.pop_back(); // remove moved record
-    }
+        if (used_doc_ids_.test(record.doc_id_)) {
+          continue; // record still in use
+        }
 
-    if (!column.entries_.empty() || column.refs_) {
-      ++itr;
-      continue; // column still in use
+        record = std::move(column.entries_[last--]); // replace unused record
+        column.entries_.pop_back(); // remove moved record
+      }
+
+      if (!column.entries_.empty() || column.refs_) {
+        ++itr;
+        continue; // column still in use
+      }
     }
 
     used_column_ids_.unset(column.meta_->id); // release column id
@@ -1539,22 +1551,26 @@ void transaction_store::cleanup() {
   for (auto itr = columns_unnamed_.begin(), end = columns_unnamed_.end(); itr != end;) {
     auto& column = itr->second;
     auto id = itr->first;
-    size_t last = column.entries_.size() - 1;
 
-    for (auto i = column.entries_.size(); i;) {
-      auto& record = column.entries_[--i];
+    {
+      SCOPED_LOCK(column.mutex_); // writers may append to a referenced column
+      size_t last = column.entries_.size() - 1;
 
-      if (used_doc_ids_.test(record.doc_id_)) {
-        continue; // record still in use
-      }
+      for (auto i = column.entries_.size(); i;) {
+        auto& record = column.entries_[--i];
 
-      record = std::move(column.entries_[last--]); // replace unused record
-      column.entries_.pop_back(); // remove moved record
-    }
+        if (used_doc_ids_.test(record.doc_id_)) {
+          continue; // record still in use
+        }
 
-    if (!column.entries_.empty() || column.refs_) {
-      ++itr;
-      continue; // column still in use
+        record = std::move(column.entries_[last--]); // replace unused record
+        column.entries_.pop_back(); // remove moved record
+      }
+
+      if (!column.entries_.empty() || column.refs_) {
+        ++itr;
+        continue; // column still in use
+      }
     }
 
     used_column_ids_.unset(id); // release column id
@@ -1564,33 +1580,40 @@ void transaction_store::cleanup() {
   // remove unused records from fields
   for (auto itr = fields_.begin(), end = fields_.end(); itr != end;) {
     auto& field = itr->second;
+    bool empty = true;
 
-    for (auto term_itr = field.terms_.begin(), terms_end = field.terms_.end();
-         term_itr != terms_end;
-        ) {
-      auto& term = term_itr->second;
-      size_t last = term.entries_.size() - 1;
+    for (auto& shard: field.shards_) {
+      SCOPED_LOCK(shard.mutex_); // writers may add terms to a referenced field
 
-      for (auto i = term.entries_.size(); i;) {
-        auto& record = term.entries_[--i];
+      for (auto term_itr = shard.terms_.begin(), terms_end = shard.terms_.end();
+           term_itr != terms_end;
+          ) {
+        auto& term = term_itr->second;
+        size_t last = term.entries_.size() - 1;
 
-        if (used_doc_ids_.test(record.doc_id_)) {
-          continue; // record still in use
+        for (auto i = term.entries_.size(); i;) {
+          auto& record = term.entries_[--i];
+
+          if (used_doc_ids_.test(record.doc_id_)) {
+            continue; // record still in use
+          }
+
+          record = std::move(term.entries_[last--]); // replace unused record
+          term.entries_.pop_back(); // remove moved record
         }
 
-        record = std::move(term.entries_[last--]); // replace unused record
-        term.entries_.pop_back(); // remove moved record
-      }
+        if (!term.entries_.empty()) {
+          ++term_itr;
+          continue; // term still in use
+        }
 
-      if (!term.entries_.empty()) {
-        ++term_itr;
-        continue; // term still in use
+        term_itr = shard.terms_.erase(term_itr);
       }
 
-      term_itr = field.terms_.erase(term_itr);
+      empty &= shard.terms_.empty();
     }
 
-    if (!field.terms_.empty() || field.refs_) {
+    if (!empty || field.refs_) {
       ++itr;
       continue; // field still in use
     }
@@ -1637,6 +1660,18 @@ transaction_store::column_ref_t transaction_store::get_column(
     return value.meta_ ? hashed_string_ref(key.hash(), value.meta_->name) : key;
   };
 
+  // fast path for an existing column
+  {
+    async_utils::read_write_mutex::read_mutex mutex(mutex_);
+    SCOPED_LOCK(mutex);
+    auto itr = columns_named_.find(name);
+
+    if (itr != columns_named_.end()) {
+      // increment ref counter under lock to coordinate with cleanup(...)
+      return column_ref_t(itr->second);
+    }
+  }
+
   async_utils::read_write_mutex::write_mutex mutex(mutex_);
   SCOPED_LOCK(mutex);
 
@@ -1657,6 +1692,8 @@ transaction_store::column_ref_t transaction_store::get_column(
         "failed to allocate buffer for column meta while indexing new column: %s",
         std::string(name.c_str(), name.size()).c_str()
       );
+
+      return column_ref_t();
     }
 
     column.meta_->id = get_column_id();
@@ -1737,6 +1774,23 @@ transaction_store::field_ref_t transaction_store::get_field(
     return value.meta_ ? hashed_string_ref(key.hash(), value.meta_->name) : key;
   };
 
+  // fast path for an existing field
+  {
+    async_utils::read_write_mutex::read_mutex mutex(mutex_);
+    SCOPED_LOCK(mutex);
+    auto itr = fields_.find(name);
+
+    if (itr != fields_.end()) {
+      auto& field = itr->second;
+
+      // increment ref counter under lock to coordinate with cleanup(...)
+      return features.is_subset_of(field.meta_->features)
+        ? field_ref_t(field)
+        : field_ref_t() // new field features are not a subset of existing field features
+        ;
+    }
+  }
+
   async_utils::read_write_mutex::write_mutex mutex(mutex_);
   SCOPED_LOCK(mutex);
   auto itr = map_utils::try_emplace_update_key(
@@ -238,6 +238,7 @@ class IRESEARCH_API transaction_store: private util::noncopyable {
 
   struct column_t: private util::noncopyable { // no copy because of ref tracking
     std::vector<document_entry_t> entries_;
+    mutable std::mutex mutex_; // mutex for 'entries_', obtained after 'transaction_store::mutex_'
     std::atomic<size_t> refs_{}; // ref tracking for term addition/write-pending operations
   };
 
@@ -266,10 +267,22 @@ class IRESEARCH_API transaction_store: private util::noncopyable {
   };
 
   struct terms_t: private util::noncopyable { // no copy because of ref tracking
+    // terms are split by hash into shards with a separate mutex each,
+    // so that writers indexing the same field rarely wait for each other
+    static const size_t SHARDS = 16; // arbitrary value
+
+    struct shard_t {
+      mutable std::mutex mutex_; // mutex for 'terms_', obtained after 'transaction_store::mutex_'
+      std::unordered_map<hashed_bytes_ref, postings_t> terms_;
+    };
+
     const field_meta_builder::ptr meta_;
     ref_t<column_t> norm_col_ref_;
     std::atomic<size_t> refs_{}; // ref tracking for term addition/write-pending operations
-    std::unordered_map<hashed_bytes_ref, postings_t> terms_;
+    shard_t shards_[SHARDS];
+
+    shard_t& shard(size_t hash) noexcept { return shards_[hash % SHARDS]; }
+
     terms_t(
         field_meta_pool_t& pool, const string_ref& name, const flags& features
     ): meta_(pool.emplace().release()) {
@@ -290,9 +303,9 @@ class IRESEARCH_API transaction_store: private util::noncopyable {
   std::unordered_map<field_id, column_t> columns_unnamed_; // system columns
   field_meta_pool_t field_meta_pool_;
   std::unordered_map<hashed_string_ref, terms_t> fields_;
-  size_t generation_; // current commit generation
+  std::atomic<size_t> generation_; // current commit generation, modified under write lock on 'mutex_' only
   std::mutex generation_mutex_; // prevent generation modification during writer commit with removals/updates and flush (used before aquiring write lock on mutex_)
-  mutable async_utils::read_write_mutex mutex_; // mutex for 'columns_', 'fields_', 'generation_', 'visible_docs_'
+  mutable async_utils::read_write_mutex mutex_; // mutex for 'columns_', 'fields_', 'generation_', 'visible_docs_' (entries of a column/terms of a field are guarded by their own mutex)
   reusable_t reusable_;
   bitvector used_column_ids_; // true == column id is in use by some column
 
@@ -26,6 +26,7 @@
 #endif
 
 #include <stdint.h>
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 #include "parser_context.hpp"
@@ -39,6 +40,14 @@ using namespace iresearch::iql;
 namespace {
   const parser::semantic_type UNKNOWN = 0; // no known value
   const parser::semantic_type TRUE = 1; // expression evaluating to true
+
+  // '$' followed by at least one letter, digit or '_'
+  bool is_placeholder(std::string const& sValue) {
+    return sValue.size() > 1 && '$' == sValue[0] &&
+      std::all_of(sValue.begin() + 1, sValue.end(), [](char c)->bool {
+        return isalnum((uint8_t)c) || '_' == c;
+      });
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -46,8 +55,11 @@ namespace {
 // -----------------------------------------------------------------------------
 
 parser_context::parser_context(
-  std::string const& sData, functions const& functions /*= defaults::FUNCTIONS*/
-): m_sData(sData), m_functions(functions), m_nNext(0), m_eState(StateType::NONE)
+  std::string const& sData,
+  functions const& functions /*= defaults::FUNCTIONS*/,
+  bool bPlaceholders /*= false*/
+): m_sData(sData), m_functions(functions), m_nNext(0), m_eState(StateType::NONE),
+   m_bPlaceholders(bPlaceholders)
 {
   m_nodes.resize(2); // add an error node at position 0 (a.k.a. UNKNOWN)
 
@@ -123,6 +135,13 @@ parser::semantic_type parser_context::sequence(
     location.begin.column, location.end.column - location.begin.column
   );
 
+  // quoted sequences are always literals
+  node.bPlaceholder = m_bPlaceholders &&
+    (!location.begin.column ||
+     ('"' != m_sData[location.begin.column - 1] &&
+      '\'' != m_sData[location.begin.column - 1])) &&
+    is_placeholder(node.sValue);
+
   return value; // ID of new node
 }
 
@@ -149,6 +168,9 @@ parser::semantic_type parser_context::append(
 
   node.sValue.append(sValue);
 
+  // e.g. '$a' followed by '_b'
+  node.bPlaceholder = node.bPlaceholder && is_placeholder(node.sValue);
+
   return value; // ID of modified node
 }
 
@@ -841,7 +863,7 @@ parser_context::query_node const& parser_context::find_node(
 ////////////////////////////////////////////////////////////////////////////////
 void parser_context::print(
   std::ostream & out, parser::semantic_type const& root, bool bBoost, bool bId
-) {
+) const {
   auto const& node = find_node(root);
   std::string sChildDelim = "";
 
@@ -1360,8 +1382,10 @@ parser::semantic_type parser_context::try_eval(
 
       auto& childNode = find_node(child);
 
-      // only SEQUENCE args are supported by determinitic functions
-      if (query_node::NodeType::SEQUENCE != childNode.type) {
+      // only SEQUENCE args are supported by determinitic functions,
+      // placeholder values are not known until the query is built
+      if (query_node::NodeType::SEQUENCE != childNode.type ||
+          childNode.bPlaceholder) {
         bDeterministic = false; // not a deterministic argument, cannot eval
       }
 
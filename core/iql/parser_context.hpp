@@ -40,7 +40,15 @@ namespace iresearch {
   namespace iql {
     class parser_context: public context {
     public:
-      parser_context(std::string const& sData, functions const& functions = functions::DEFAULT());
+      ////////////////////////////////////////////////////////////////////////////////
+      /// @param bPlaceholders treat unquoted '$name' sequences as placeholders for
+      ///        values bound after parsing
+      ////////////////////////////////////////////////////////////////////////////////
+      parser_context(
+        std::string const& sData,
+        functions const& functions = functions::DEFAULT(),
+        bool bPlaceholders = false
+      );
       parser_context& operator=(parser_context&) = delete; // because of references
 
       // parser operations
@@ -86,6 +94,9 @@ namespace iresearch {
         // valid for SEQUENCE, (for: FUNCTION - may contain function name, used by print(...) only)
         std::string sValue;
 
+        // valid for SEQUENCE, 'sValue' is a '$name' placeholder, never evaluated during parsing
+        bool bPlaceholder = false;
+
         // valid for RANGE
         bool bBeginInclusive;
         bool bEndInclusive;
@@ -124,7 +135,7 @@ namespace iresearch {
       query_node const& find_node(parser::semantic_type const& value) const;
       template<typename T>
       typename T::contextual_function_t const& function(T const& fn) const { return fn.m_fnContextual; }
-      void print(std::ostream& out, parser::semantic_type const& root, bool bBoost = false, bool bId = false);
+      void print(std::ostream& out, parser::semantic_type const& root, bool bBoost = false, bool bId = false) const;
     private:
       std::string const& m_sData;
       std::pair<bool, query_position> m_error;
@@ -136,6 +147,7 @@ namespace iresearch {
       std::unordered_map<size_t, size_t> m_negatedNodeCache;
       std::vector<std::pair<size_t, bool>> m_order;
       enum StateType { NONE, SINGLE, DOUBLE } m_eState;
+      bool m_bPlaceholders;
 
       void add_child(std::vector<size_t>& children, parser::semantic_type const& child, bool bRemoveSuperset);
       query_node& create_node(parser::semantic_type& value);
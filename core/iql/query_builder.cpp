@@ -291,24 +291,47 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
   };
   DEFINE_FACTORY_DEFAULT(RootNode)
 
-  class parse_context: public irs::iql::parser_context {
+  ////////////////////////////////////////////////////////////////////////////////
+  /// @brief the parsed query, read-only once parsed, i.e. may be shared by
+  ///        concurrent builds
+  ////////////////////////////////////////////////////////////////////////////////
+  class plan_context: public irs::iql::parser_context {
+   public:
+    using parser_context::parser_context;
+    using parser_context::query_node;
+    using parser_context::current_state;
+    using parser_context::function;
+    using parser_context::print;
+
+    query_node const& find_node(
+      irs::iql::parser::semantic_type const& value
+    ) const {
+      return parser_context::find_node(value);
+    }
+  };
+
+  class parse_context {
    public:
     parse_context(
-      const std::string& sQuery,
+      const plan_context& plan,
       const std::locale& locale,
       void* cookie,
-      const irs::iql::functions& functions,
-      const irs::iql::query_builder::branch_builders& branch_builders
+      const irs::iql::query_builder::branch_builders& branch_builders,
+      const irs::iql::query_plan::params_t* params = nullptr
     );
-    irs::iql::query build();
-    irs::iql::query buildError();
+    irs::iql::query build() const;
+    irs::iql::query buildError() const;
 
    private:
+    typedef plan_context::query_node query_node;
+
     static const irs::iql::parser::semantic_type SUCCESS;
     static const irs::iql::parser::semantic_type UNKNOWN;
+    const plan_context& m_plan;
     const irs::iql::query_builder::branch_builders& m_branch_builders;
     void* m_cookie;
     const std::locale& m_locale;
+    const irs::iql::query_plan::params_t* m_params;
 
     irs::iql::parser::semantic_type append_function_arg(
       irs::iql::function_arg::fn_args_t& buf,
@@ -328,12 +351,28 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
       const std::vector<size_t>& args,
       const ctx_args_type&... ctx_args
     ) const; // @return SUCCESS or ID of failed node, or UNKNOWN for self
+    auto current_state() const {
+      return m_plan.current_state();
+    }
     query_node const& find_node(
       irs::iql::parser::semantic_type const& value
     ) const {
-      // force visibility only of const fn for GCC, otherwise it tries private fn
-      return parser_context::find_node(value);
+      return m_plan.find_node(value);
+    }
+    template<typename T>
+    typename T::contextual_function_t const& function(T const& fn) const {
+      return m_plan.function(fn);
     }
+    void print(
+      std::ostream& out,
+      irs::iql::parser::semantic_type const& root,
+      bool bBoost = false,
+      bool bId = false
+    ) const {
+      m_plan.print(out, root, bBoost, bId);
+    }
+    // @return value of a SEQUENCE node, NIL for an unbound placeholder
+    irs::string_ref value(const query_node& node) const;
     template <typename T> // @return SUCCESS or ID of failed node, or UNKNOWN for self
     irs::iql::parser::semantic_type init(T& node, const query_node& src) const;
     irs::iql::parser::semantic_type initRange(
@@ -358,16 +397,17 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
     std::numeric_limits<irs::iql::parser::semantic_type>::max() - 1; // init() unknown failure
 
   parse_context::parse_context(
-    const std::string& sQuery,
+    const plan_context& plan,
     const std::locale& locale,
     void* cookie,
-    const irs::iql::functions& functions,
-    const irs::iql::query_builder::branch_builders& branch_builders
+    const irs::iql::query_builder::branch_builders& branch_builders,
+    const irs::iql::query_plan::params_t* params /*= nullptr*/
   ):
-    parser_context(sQuery, functions),
+    m_plan(plan),
     m_branch_builders(branch_builders),
     m_cookie(cookie),
-    m_locale(locale) {
+    m_locale(locale),
+    m_params(params) {
   }
 
   // add implementation before any calls to the function
@@ -495,7 +535,7 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
     return SUCCESS;
   }
 
-  irs::iql::query parse_context::build() {
+  irs::iql::query parse_context::build() const {
     auto state = current_state();
     irs::iql::query result;
 
@@ -562,7 +602,7 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
     return result;
   }
 
-  irs::iql::query parse_context::buildError() {
+  irs::iql::query parse_context::buildError() const {
     auto state = current_state();
     std::stringstream error;
 
@@ -694,9 +734,16 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
         );
       });
       return SUCCESS;
-     case query_node::NodeType::SEQUENCE:
-      buf.emplace_back(irs::ref_cast<irs::byte_type>(irs::string_ref(node.sValue)));
+     case query_node::NodeType::SEQUENCE: {
+      auto nodeValue = value(node);
+
+      if (nodeValue.null()) {
+        return node_id; // unbound placeholder
+      }
+
+      buf.emplace_back(irs::ref_cast<irs::byte_type>(nodeValue));
       return SUCCESS;
+     }
      default: {} // NOOP
     }
 
@@ -746,9 +793,16 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
     const query_node& src
   ) const {
     switch(src.type) {
-     case query_node::NodeType::SEQUENCE:
-      buf.append(irs::ref_cast<irs::byte_type>(irs::string_ref(src.sValue)));
+     case query_node::NodeType::SEQUENCE: {
+      auto srcValue = value(src);
+
+      if (srcValue.null()) {
+        return UNKNOWN; // unbound placeholder
+      }
+
+      buf.append(irs::ref_cast<irs::byte_type>(srcValue));
       break;
+     }
      case query_node::NodeType::FUNCTION:
       if (src.pFnSequence) {
         auto errorNodeId = eval<irs::iql::sequence_function, std::locale, void*>(
@@ -770,6 +824,20 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
     return SUCCESS;
   }
 
+  irs::string_ref parse_context::value(const query_node& node) const {
+    if (!node.bPlaceholder) {
+      return node.sValue;
+    }
+
+    if (!m_params) {
+      return irs::string_ref::NIL;
+    }
+
+    auto itr = m_params->find(node.sValue.substr(1)); // +1 for '$'
+
+    return itr == m_params->end() ? irs::string_ref::NIL : irs::string_ref(itr->second);
+  }
+
   irs::iql::parser::semantic_type parse_context::order(
     irs::order& node, const std::vector<std::pair<size_t, bool>>& order
   ) const {
@@ -887,6 +955,57 @@ const irs::iql::query_builder::branch_builder_function_t SIMILAR_BRANCH_BUILDER
       ? SUCCESS : UNKNOWN;
   }
 
+  // link the query into both the root and result.filter via two LinkNodes
+  irs::iql::query link(irs::iql::query&& result, irs::iql::proxy_filter* root) {
+    if (root && !result.error) {
+      auto& link = root->proxy<LinkNode>(result.filter.get());
+      result.filter.release();
+
+      result.filter = LinkNode::make(link);
+    }
+
+    return std::move(result);
+  }
+
+  class compiled_query final: public irs::iql::query_plan {
+   public:
+    compiled_query(
+      const std::string& sQuery,
+      const std::locale& locale,
+      const irs::iql::functions& functions,
+      const irs::iql::query_builder::branch_builders& branch_builders
+    ):
+      m_sQuery(sQuery),
+      m_plan(m_sQuery, functions, true),
+      m_locale(locale),
+      m_branch_builders(branch_builders) {
+      irs::iql::parser parser(m_plan);
+
+      m_bValid = !parser.parse();
+    }
+
+    virtual irs::iql::query build(
+      const params_t& params,
+      void* cookie /*= nullptr*/,
+      irs::iql::proxy_filter* root /*= nullptr*/
+    ) const override {
+      parse_context ctx(m_plan, m_locale, cookie, m_branch_builders, &params);
+
+      if (!m_bValid) {
+        return ctx.buildError();
+      }
+
+      return link(ctx.build(), root);
+    }
+
+   private:
+    const std::string m_sQuery; // referenced by 'm_plan'
+    plan_context m_plan;
+    const std::locale m_locale;
+    const irs::iql::query_builder::branch_builders& m_branch_builders;
+    bool m_bValid;
+  };
+
 NS_END
 
 NS_ROOT
@@ -933,28 +1052,91 @@ query query_builder::build(
   void* cookie /*= nullptr*/,
   proxy_filter* root /*= nullptr*/
 ) const {
-  parse_context ctx(query, locale, cookie, iql_functions_, branch_builders_);
-  parser parser(ctx);
+  plan_context plan(query, iql_functions_);
+  parser parser(plan);
+  parse_context ctx(plan, locale, cookie, branch_builders_);
 
   if (parser.parse()) {
     return ctx.buildError();
   }
 
-  if (!root) {
-    return ctx.build();
+  return link(ctx.build(), root);
+}
+
+query_plan::ptr query_builder::compile(
+  const std::string& query,
+  const std::locale& locale
+) const {
+  return std::make_shared<compiled_query>(
+    query, locale, iql_functions_, branch_builders_
+  );
+}
+
+query_plan_cache::query_plan_cache(
+  const query_builder& builder,
+  size_t capacity
+): builder_(builder), capacity_(std::max(size_t(1), capacity)) {
+}
+
+query_plan::ptr query_plan_cache::get(
+  const std::string& query,
+  const std::locale& locale
+) {
+  // the same query may be built differently for different locales
+  auto key = query;
+  key.push_back('\0');
+  key.append(irs::locale_utils::name(locale));
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto itr = index_.find(key);
+
+    if (itr != index_.end()) {
+      entries_.splice(entries_.begin(), entries_, itr->second);
+
+      return itr->second->second;
+    }
   }
 
-  auto result = ctx.build();
+  // parse outside of the lock, a concurrent miss on the same
+  // query wastes a parse but doesn't block the other queries
+  auto plan = builder_.compile(query, locale);
 
-  // link the query into both the root and result.filter via two LinkNodes
-  if (!result.error) {
-    auto& link = root->proxy<LinkNode>(result.filter.get());
-    result.filter.release();
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto itr = index_.find(key);
 
-    result.filter = LinkNode::make(link);
+  if (itr != index_.end()) {
+    entries_.splice(entries_.begin(), entries_, itr->second);
+
+    return itr->second->second; // cached by a concurrent call
+  }
+
+  entries_.emplace_front(key, plan);
+
+  try {
+    index_.emplace(std::move(key), entries_.begin());
+  } catch (...) {
+    entries_.pop_front();
+    throw;
+  }
+
+  if (entries_.size() > capacity_) {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
   }
 
-  return result;
+  return plan;
+}
+
+void query_plan_cache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  index_.clear();
+  entries_.clear();
+}
+
+size_t query_plan_cache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
 }
 
 // -----------------------------------------------------------------------------
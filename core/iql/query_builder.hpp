@@ -24,9 +24,13 @@
 #ifndef IRESEARCH_IQL_QUERY_BUILDER_H
 #define IRESEARCH_IQL_QUERY_BUILDER_H
 
+#include <list>
+#include <mutex>
+
 #include "shared.hpp"
 #include "parser_common.hpp"
 #include "search/filter.hpp"
+#include "utils/noncopyable.hpp"
 
 namespace iresearch {
   namespace iql {
@@ -107,6 +111,33 @@ namespace iresearch {
       }
     };
 
+    ////////////////////////////////////////////////////////////////////////////////
+    /// @brief a textual query parsed once and built into iResearch queries on
+    ///        demand, unquoted '$name' sequences of the query are placeholders
+    ///        replaced by the values bound at build time
+    ////////////////////////////////////////////////////////////////////////////////
+    class IRESEARCH_API query_plan {
+     public:
+      typedef std::shared_ptr<const query_plan> ptr;
+      typedef std::unordered_map<std::string, std::string> params_t; // name without '$' -> value
+
+      virtual ~query_plan() = default;
+
+      ////////////////////////////////////////////////////////////////////////////////
+      /// @brief build an iResearch query from the plan, may be called concurrently
+      /// @param params the values of the placeholders used in the query
+      /// @param cookie a user-defined value passed verbatum to function invocations
+      /// @param root the node to attach the query under (if not null)
+      /// @return built query, iff error <return>.error != nullptr, e.g. on a parse
+      ///         error or a placeholder missing in 'params'
+      ////////////////////////////////////////////////////////////////////////////////
+      virtual query build(
+        const params_t& params,
+        void* cookie = nullptr,
+        proxy_filter* root = nullptr
+      ) const = 0;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////
     /// @brief helper class for transforming a textual query into an iResearch query
     ////////////////////////////////////////////////////////////////////////////////
@@ -175,10 +206,52 @@ namespace iresearch {
         proxy_filter* root = nullptr
       ) const;
 
+      ////////////////////////////////////////////////////////////////////////////////
+      /// @brief parse a textual query with placeholders into a reusable plan
+      /// @param query the query to parse, deterministic functions over placeholders
+      ///        are evaluated via their contextual implementation at build time,
+      ///        a limit may not be a placeholder
+      /// @param locale the locale to use for building the query
+      /// @return the plan (never nullptr) referencing the functions and branch
+      ///         builders of this builder, parse errors are reported by build(...)
+      ////////////////////////////////////////////////////////////////////////////////
+      query_plan::ptr compile(
+        const std::string& query,
+        const std::locale& locale
+      ) const;
+
      private:
       const branch_builders& branch_builders_;
       const functions& iql_functions_;
     };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    /// @brief thread-safe cache of the most recently used plans of a query_builder
+    ////////////////////////////////////////////////////////////////////////////////
+    class IRESEARCH_API query_plan_cache: private util::noncopyable {
+     public:
+      query_plan_cache(const query_builder& builder, size_t capacity);
+
+      ////////////////////////////////////////////////////////////////////////////////
+      /// @return the cached plan for 'query' or a newly compiled one, evicting
+      ///         the least recently used plan if the cache is full
+      ////////////////////////////////////////////////////////////////////////////////
+      query_plan::ptr get(const std::string& query, const std::locale& locale);
+
+      void clear();
+      size_t size() const;
+
+     private:
+      typedef std::list<std::pair<std::string, query_plan::ptr>> entries_t;
+
+      IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+      const query_builder& builder_;
+      const size_t capacity_;
+      mutable std::mutex mutex_;
+      entries_t entries_; // most recently used first
+      std::unordered_map<std::string, entries_t::iterator> index_;
+      IRESEARCH_API_PRIVATE_VARIABLES_END
+    };
   }
 }
 
@@ -67,13 +67,15 @@ class all_terms_collector : util::noncopyable {
     state_.docs_count = meta ? &meta->docs_count : &no_docs_;
   }
 
-  void visit(const boost_t boost) {
+  bool visit(const boost_t boost) {
     assert(state_);
     term_stats_.collect(*state_.segment, *state_.state->reader, stat_index_, *state_.terms);
 
     auto& state = *state_.state;
     state.scored_states.emplace_back(state_.terms->cookie(), stat_index_, boost);
     state.scored_states_estimation += *state_.docs_count;
+
+    return true;
   }
 
   uint32_t stat_index() const noexcept { return stat_index_; }
@@ -22,13 +22,20 @@
 
 #include "boolean_filter.hpp"
 
+#include <map>
+
 #include <boost/functional/hash.hpp>
 
 #include "all_filter.hpp"
 #include "conjunction.hpp"
 #include "disjunction.hpp"
 #include "min_match_disjunction.hpp"
+#include "cancellation.hpp"
 #include "exclusion.hpp"
+#include "term_filter.hpp"
+#include "terms_filter.hpp"
+#include "formats/formats.hpp"
+#include "index/index_reader.hpp"
 
 NS_LOCAL
 
@@ -45,6 +52,135 @@ std::pair<const irs::filter*, bool> optimize_not(const irs::Not& node) {
   return std::make_pair(inner, neg);
 }
 
+//////////////////////////////////////////////////////////////////////////////
+/// @brief replaces 'by_term' filters over the same field with a single
+///        'by_terms' filter per field, i.e. a single term dictionary pass
+///        and a single disjunction per field, duplicate terms are left as
+///        is since 'by_terms' would collapse them
+//////////////////////////////////////////////////////////////////////////////
+void merge_terms(
+    std::vector<const irs::filter*>& filters,
+    std::vector<irs::filter::ptr>& merged) {
+  const auto is_term = [](const irs::filter* filter) {
+    return irs::type<irs::by_term>::id() == filter->type();
+  };
+
+  if (std::count_if(filters.begin(), filters.end(), is_term) < 2) {
+    // nothing to merge
+    return;
+  }
+
+  constexpr size_t DUPLICATE = irs::integer_traits<size_t>::const_max;
+
+  // field -> positions of 'by_term' filters
+  std::map<irs::string_ref, std::vector<size_t>> fields;
+
+  for (size_t i = 0, size = filters.size(); i < size; ++i) {
+    if (is_term(filters[i])) {
+      fields[static_cast<const irs::by_term*>(filters[i])->field()].push_back(i);
+    }
+  }
+
+  for (auto& entry : fields) {
+    auto& positions = entry.second;
+
+    if (positions.size() < 2) {
+      continue;
+    }
+
+    auto terms = irs::memory::make_unique<irs::by_terms>();
+    auto& options = *terms->mutable_options();
+
+    for (auto& pos : positions) {
+      const auto& term = static_cast<const irs::by_term&>(*filters[pos]);
+
+      if (!options.terms.emplace(term.options().term, term.boost()).second) {
+        pos = DUPLICATE;
+      }
+    }
+
+    if (options.terms.size() < 2) {
+      continue;
+    }
+
+    *terms->mutable_field() = entry.first;
+
+    const irs::filter* replacement = terms.get();
+    for (const auto pos : positions) {
+      if (DUPLICATE != pos) {
+        filters[pos] = replacement;
+        replacement = nullptr;
+      }
+    }
+
+    merged.emplace_back(std::move(terms));
+  }
+
+  filters.erase(
+    std::remove(filters.begin(), filters.end(), nullptr),
+    filters.end());
+}
+
+constexpr uint64_t UNKNOWN_COST = irs::integer_traits<uint64_t>::const_max;
+
+//////////////////////////////////////////////////////////////////////////////
+/// @returns estimated number of documents matched by the specified filter
+///          in the whole index based on term statistics, 'UNKNOWN_COST' for
+///          filters which can't be estimated without being prepared
+//////////////////////////////////////////////////////////////////////////////
+uint64_t estimate(const irs::index_reader& index, const irs::filter& filter) {
+  irs::string_ref field;
+  std::vector<irs::bytes_ref> terms;
+
+  if (irs::type<irs::by_term>::id() == filter.type()) {
+    const auto& term = static_cast<const irs::by_term&>(filter);
+    field = term.field();
+    terms.emplace_back(term.options().term);
+  } else if (irs::type<irs::by_terms>::id() == filter.type()) {
+    const auto& term = static_cast<const irs::by_terms&>(filter);
+    field = term.field();
+    for (auto& search_term : term.options().terms) {
+      terms.emplace_back(search_term.term);
+    }
+  } else {
+    return UNKNOWN_COST;
+  }
+
+  uint64_t docs_count = 0;
+
+  for (auto& segment : index) {
+    const auto* reader = segment.field(field);
+
+    if (!reader) {
+      continue;
+    }
+
+    auto it = reader->iterator();
+
+    if (!it) {
+      continue;
+    }
+
+    for (auto& term : terms) {
+      if (!it->seek(term)) {
+        continue;
+      }
+
+      it->read();
+
+      const auto* meta = irs::get<irs::term_meta>(*it);
+
+      if (!meta) {
+        return UNKNOWN_COST;
+      }
+
+      docs_count += meta->docs_count;
+    }
+  }
+
+  return docs_count;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 /// @returns disjunction iterator created from the specified queries
 //////////////////////////////////////////////////////////////////////////////
@@ -80,9 +216,10 @@ irs::doc_iterator::ptr make_disjunction(
     }
   }
 
-  return irs::make_disjunction<disjunction_t>(
-    std::move(itrs), ord, std::forward<Args>(args)...
-  );
+  return irs::make_cancellable(
+    irs::make_disjunction<disjunction_t>(
+      std::move(itrs), ord, std::forward<Args>(args)...),
+    ctx);
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -123,9 +260,10 @@ irs::doc_iterator::ptr make_conjunction(
     itrs.emplace_back(std::move(docs));
   }
 
-  return irs::make_conjunction<conjunction_t>(
-     std::move(itrs), ord, std::forward<Args>(args)...
-  );
+  return irs::make_cancellable(
+    irs::make_conjunction<conjunction_t>(
+      std::move(itrs), ord, std::forward<Args>(args)...),
+    ctx);
 }
 
 NS_END // LOCAL
@@ -157,8 +295,9 @@ class boolean_query : public filter::prepared {
     assert(excl_);
     auto incl = execute(rdr, ord, ctx, begin(), begin() + excl_);
 
-    // exclusion part does not affect scoring at all
-    auto excl = ::make_disjunction(rdr, order::prepared::unordered(), ctx,
+    // exclusion part does not affect scoring at all and can't be cancelled
+    const cancellation_mask excl_ctx(ctx);
+    auto excl = ::make_disjunction(rdr, order::prepared::unordered(), &excl_ctx,
                                    begin() + excl_, end());
 
     // got empty iterator for excluded
@@ -190,11 +329,12 @@ class boolean_query : public filter::prepared {
       queries.emplace_back(filter->prepare(rdr, ord, boost, ctx));
     }
 
-    // prepare excluded
+    // prepare excluded, cancelling exclusion would widen the result set
+    const cancellation_mask excl_ctx(ctx);
     for (const auto* filter : excl) {
       // exclusion part does not affect scoring at all
       queries.emplace_back(filter->prepare(
-        rdr, order::prepared::unordered(), irs::no_boost(), ctx
+        rdr, order::prepared::unordered(), irs::no_boost(), &excl_ctx
       ));
     }
 
@@ -307,9 +447,9 @@ class min_match_query final : public boolean_query {
       }
     }
 
-    return make_min_match_disjunction(
-      std::move(itrs), ord, min_match_count
-    );
+    return make_cancellable(
+      make_min_match_disjunction(std::move(itrs), ord, min_match_count),
+      ctx);
   }
 
  private:
@@ -391,6 +531,9 @@ filter::prepared::ptr boolean_filter::prepare(
   group_filters(incl, excl);
   remove_excess(incl, excl, boost);
 
+  std::vector<filter::ptr> merged;
+  merge_terms(incl, excl, merged);
+
   all all_docs;
   if (incl.empty() && !excl.empty()) {
     // single negative query case
@@ -400,7 +543,7 @@ filter::prepared::ptr boolean_filter::prepare(
   return prepare(incl, excl, rdr, ord, boost, ctx);
 }
 
-void boolean_filter::group_filters(
+bool boolean_filter::group_filters(
     std::vector<const filter*>& incl,
     std::vector<const filter*>& excl) const {
   incl.reserve(size() / 2);
@@ -422,17 +565,52 @@ void boolean_filter::group_filters(
         if (irs::type<all>::id() == res.first->type()) {
           // not all -> empty result
           incl.clear();
-          return;
+          return false;
         }
 
-        excl.push_back(res.first);
+        if (irs::type<Or>::id() != res.first->type()
+            || !exclude(static_cast<const Or&>(*res.first), excl)) {
+          excl.push_back(res.first);
+        }
       } else {
         incl.push_back(res.first);
       }
+    } else if (type() == begin->type()
+               && no_boost() == begin->boost()
+               && flatten(static_cast<const boolean_filter&>(*begin), incl, excl)) {
+      // subfilters of the nested node have been merged into the current one
     } else {
       incl.push_back(&*begin);
     }
   }
+
+  return true;
+}
+
+bool boolean_filter::exclude(
+    const Or& node,
+    std::vector<const filter*>& excl) const {
+  if (1 != node.min_match_count()) {
+    return false;
+  }
+
+  std::vector<const filter*> node_incl;
+  std::vector<const filter*> node_excl;
+
+  if (!node.group_filters(node_incl, node_excl) || !node_excl.empty()) {
+    // nested negation can't be expressed via a flat exclusion list
+    return false;
+  }
+
+  excl.insert(excl.end(), node_incl.begin(), node_incl.end());
+  return true;
+}
+
+void boolean_filter::merge_terms(
+    std::vector<const filter*>& /*incl*/,
+    std::vector<const filter*>& excl,
+    std::vector<filter::ptr>& merged) const {
+  ::merge_terms(excl, merged);
 }
 
 // ----------------------------------------------------------------------------
@@ -477,6 +655,33 @@ void And::remove_excess(
   incl.erase(it, incl.end());
 }
 
+bool And::flatten(
+    const boolean_filter& node,
+    std::vector<const filter*>& incl,
+    std::vector<const filter*>& excl) const {
+  std::vector<const filter*> node_incl;
+  std::vector<const filter*> node_excl;
+
+  if (!static_cast<const And&>(node).group_filters(node_incl, node_excl)
+      || (node_incl.empty() && node_excl.empty())) {
+    // empty nested node turns the whole conjunction into an empty one
+    return false;
+  }
+
+  if (std::any_of(
+        node_incl.begin(), node_incl.end(),
+        [](const irs::filter* filter) {
+          return irs::type<all>::id() == filter->type();
+      })) {
+    // boost of `all` filters would be applied to the current node
+    return false;
+  }
+
+  incl.insert(incl.end(), node_incl.begin(), node_incl.end());
+  excl.insert(excl.end(), node_excl.begin(), node_excl.end());
+  return true;
+}
+
 filter::prepared::ptr And::prepare(
     const std::vector<const filter*>& incl,
     const std::vector<const filter*>& excl,
@@ -494,8 +699,38 @@ filter::prepared::ptr And::prepare(
     return incl.front()->prepare(rdr, ord, boost, ctx);
   }
 
+  // prepare and execute the most selective subfilters first since
+  // conjunction stops on the first exhausted one, subfilters which
+  // can't be estimated preserve their relative order at the end
+  std::vector<std::pair<uint64_t, const filter*>> costs;
+  costs.reserve(incl.size());
+
+  for (const auto* filter : incl) {
+    const auto cost = estimate(rdr, *filter);
+
+    if (0 == cost) {
+      // no document contains the term
+      return prepared::empty();
+    }
+
+    costs.emplace_back(cost, filter);
+  }
+
+  std::stable_sort(
+    costs.begin(), costs.end(),
+    [](const std::pair<uint64_t, const filter*>& lhs,
+       const std::pair<uint64_t, const filter*>& rhs) {
+      return lhs.first < rhs.first;
+  });
+
+  std::vector<const filter*> ordered;
+  ordered.reserve(costs.size());
+  for (auto& entry : costs) {
+    ordered.push_back(entry.second);
+  }
+
   auto q = and_query::make<and_query>();
-  q->prepare(rdr, ord, boost, ctx, incl, excl);
+  q->prepare(rdr, ord, boost, ctx, ordered, excl);
   return q;
 }
 
@@ -530,6 +765,40 @@ void Or::remove_excess(
   incl.erase(it, incl.end());
 }
 
+bool Or::flatten(
+    const boolean_filter& node,
+    std::vector<const filter*>& incl,
+    std::vector<const filter*>& /*excl*/) const {
+  const auto& or_node = static_cast<const Or&>(node);
+
+  if (1 != min_match_count_ || 1 != or_node.min_match_count_) {
+    return false;
+  }
+
+  std::vector<const filter*> node_incl;
+  std::vector<const filter*> node_excl;
+
+  if (!or_node.group_filters(node_incl, node_excl) || !node_excl.empty()) {
+    // exclusion is scoped to the nested node
+    return false;
+  }
+
+  incl.insert(incl.end(), node_incl.begin(), node_incl.end());
+  return true;
+}
+
+void Or::merge_terms(
+    std::vector<const filter*>& incl,
+    std::vector<const filter*>& excl,
+    std::vector<filter::ptr>& merged) const {
+  if (1 == min_match_count_) {
+    // pure disjunction
+    ::merge_terms(incl, merged);
+  }
+
+  boolean_filter::merge_terms(incl, excl, merged);
+}
+
 filter::prepared::ptr Or::prepare(
     const std::vector<const filter*>& incl,
     const std::vector<const filter*>& excl,
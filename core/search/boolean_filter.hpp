@@ -30,6 +30,8 @@
 
 NS_ROOT
 
+class Or;
+
 //////////////////////////////////////////////////////////////////////////////
 /// @class boolean_filter
 /// @brief defines user-side boolean filter, as the container for other 
@@ -80,6 +82,29 @@ class IRESEARCH_API boolean_filter : public filter, private util::noncopyable {
     // noop
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief merges subfilters of the specified nested node of the same type
+  ///        into 'incl'/'excl' if that doesn't change the result or scores
+  /// @returns false if the nested node has to be prepared as is
+  //////////////////////////////////////////////////////////////////////////////
+  virtual bool flatten(
+      const boolean_filter& /*node*/,
+      std::vector<const filter*>& /*incl*/,
+      std::vector<const filter*>& /*excl*/) const {
+    return false;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief replaces 'by_term' subfilters over the same field with a single
+  ///        'by_terms' filter, by default only for the exclusion part since
+  ///        it's always evaluated as a disjunction
+  /// @param merged storage for the created filters, must outlive 'prepare'
+  //////////////////////////////////////////////////////////////////////////////
+  virtual void merge_terms(
+    std::vector<const filter*>& incl,
+    std::vector<const filter*>& excl,
+    std::vector<filter::ptr>& merged) const;
+
   virtual filter::prepared::ptr prepare(
     const std::vector<const filter*>& incl,
     const std::vector<const filter*>& excl,
@@ -88,12 +113,20 @@ class IRESEARCH_API boolean_filter : public filter, private util::noncopyable {
     boost_t boost,
     const attribute_provider* ctx) const = 0;
 
- private:
-  void group_filters(
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief splits subfilters into included and excluded ones, subfilters of
+  ///        nested nodes are merged into the current node where possible
+  /// @returns false if the node can't match any document
+  //////////////////////////////////////////////////////////////////////////////
+  bool group_filters(
     std::vector<const filter*>& incl,
     std::vector<const filter*>& excl
   ) const;
 
+ private:
+  // not (a or b) -> not a and not b
+  bool exclude(const Or& node, std::vector<const filter*>& excl) const;
+
   IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
   filters_t filters_;
   IRESEARCH_API_PRIVATE_VARIABLES_END
@@ -121,6 +154,11 @@ class IRESEARCH_API And: public boolean_filter {
     boost_t& boost
   ) const override;
 
+  virtual bool flatten(
+    const boolean_filter& node,
+    std::vector<const filter*>& incl,
+    std::vector<const filter*>& excl) const override;
+
   virtual filter::prepared::ptr prepare(
     const std::vector<const filter*>& incl,
     const std::vector<const filter*>& excl,
@@ -164,6 +202,16 @@ class IRESEARCH_API Or : public boolean_filter {
     std::vector<const filter*>& excl,
     boost_t& boost) const override;
 
+  virtual bool flatten(
+    const boolean_filter& node,
+    std::vector<const filter*>& incl,
+    std::vector<const filter*>& excl) const override;
+
+  virtual void merge_terms(
+    std::vector<const filter*>& incl,
+    std::vector<const filter*>& excl,
+    std::vector<filter::ptr>& merged) const override;
+
   virtual filter::prepared::ptr prepare(
     const std::vector<const filter*>& incl,
     const std::vector<const filter*>& excl,
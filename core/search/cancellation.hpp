@@ -0,0 +1,222 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef IRESEARCH_CANCELLATION_H
+#define IRESEARCH_CANCELLATION_H
+
+#include <atomic>
+#include <chrono>
+
+#include "analysis/token_attributes.hpp"
+#include "index/iterators.hpp"
+#include "utils/attribute_provider.hpp"
+#include "utils/attributes.hpp"
+
+NS_ROOT
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class cancellation
+/// @brief cooperative cancellation token for a query, may be passed to
+///        'filter::prepare(...)' and 'filter::prepared::execute(...)' via
+///        the 'ctx' attribute provider
+/// @note once triggered the query stops enumerating terms/documents and
+///       returns what has been found so far, 'interrupted()' reports that
+///       the results are partial
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API cancellation final : public attribute {
+ public:
+  using clock_t = std::chrono::steady_clock;
+
+  static constexpr string_ref type_name() noexcept {
+    return "iresearch::cancellation";
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns token stored in the specified context, nullptr if none
+  //////////////////////////////////////////////////////////////////////////////
+  static const cancellation* extract(const attribute_provider* ctx) noexcept {
+    return ctx ? irs::get<cancellation>(*ctx) : nullptr;
+  }
+
+  cancellation() = default;
+
+  explicit cancellation(clock_t::duration timeout) noexcept
+    : deadline_(clock_t::now() + timeout) {
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief request cancellation, may be called from any thread
+  //////////////////////////////////////////////////////////////////////////////
+  void cancel() noexcept {
+    cancelled_.store(true, std::memory_order_relaxed);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief sets an absolute point in time after which query is cancelled
+  //////////////////////////////////////////////////////////////////////////////
+  void deadline(clock_t::time_point deadline) noexcept {
+    deadline_ = deadline;
+  }
+
+  clock_t::time_point deadline() const noexcept { return deadline_; }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if the query should stop as soon as possible
+  //////////////////////////////////////////////////////////////////////////////
+  bool check() const noexcept {
+    if (cancelled_.load(std::memory_order_relaxed)) {
+      interrupted_.store(true, std::memory_order_relaxed);
+      return true;
+    }
+
+    if (deadline_ != clock_t::time_point::max() && clock_t::now() >= deadline_) {
+      cancelled_.store(true, std::memory_order_relaxed);
+      interrupted_.store(true, std::memory_order_relaxed);
+      return true;
+    }
+
+    return false;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if some part of the query was cut short, i.e. the results
+  ///          produced so far are partial
+  //////////////////////////////////////////////////////////////////////////////
+  bool interrupted() const noexcept {
+    return interrupted_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  clock_t::time_point deadline_{ clock_t::time_point::max() };
+  mutable std::atomic<bool> cancelled_{ false };
+  mutable std::atomic<bool> interrupted_{ false };
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // cancellation
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class cancellation_mask
+/// @brief attribute provider hiding a cancellation token of the wrapped
+///        context, used for the parts of a query that must not be cut short,
+///        e.g. excluded documents of a boolean query
+//////////////////////////////////////////////////////////////////////////////
+class cancellation_mask final : public attribute_provider {
+ public:
+  explicit cancellation_mask(const attribute_provider* ctx) noexcept
+    : ctx_(ctx) {
+  }
+
+  virtual attribute* get_mutable(type_info::type_id type) override {
+    return !ctx_ || type == irs::type<cancellation>::id()
+      ? nullptr
+      : const_cast<attribute_provider*>(ctx_)->get_mutable(type);
+  }
+
+ private:
+  const attribute_provider* ctx_;
+}; // cancellation_mask
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class cancellable_doc_iterator
+/// @brief doc_iterator adapter polling a cancellation token once per
+///        'BLOCK_SIZE' steps, reports 'eof' as soon as the token fires
+//////////////////////////////////////////////////////////////////////////////
+class cancellable_doc_iterator final : public doc_iterator {
+ public:
+  static constexpr uint32_t BLOCK_SIZE = 1024;
+
+  cancellable_doc_iterator(
+      doc_iterator::ptr&& it,
+      const cancellation& token) noexcept
+    : it_(std::move(it)),
+      token_(&token) {
+    assert(it_);
+    it_doc_ = irs::get<document>(*it_);
+    assert(it_doc_);
+    doc_.value = it_doc_->value;
+  }
+
+  virtual doc_id_t value() const noexcept override {
+    return doc_.value;
+  }
+
+  virtual bool next() override {
+    if (poll()) {
+      return false;
+    }
+
+    const bool res = it_->next();
+    doc_.value = it_doc_->value;
+    return res;
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    if (target <= doc_.value) {
+      return doc_.value;
+    }
+
+    if (poll()) {
+      return doc_.value;
+    }
+
+    return (doc_.value = it_->seek(target));
+  }
+
+  virtual attribute* get_mutable(type_info::type_id type) noexcept override {
+    return type == irs::type<document>::id()
+      ? &doc_
+      : it_->get_mutable(type);
+  }
+
+ private:
+  bool poll() noexcept {
+    if (0 == (++steps_ % BLOCK_SIZE) && token_->check()) {
+      doc_.value = doc_limits::eof();
+    }
+
+    return doc_limits::eof(doc_.value);
+  }
+
+  doc_iterator::ptr it_;
+  const document* it_doc_;
+  const cancellation* token_;
+  document doc_;
+  uint32_t steps_{};
+}; // cancellable_doc_iterator
+
+//////////////////////////////////////////////////////////////////////////////
+/// @returns the specified iterator wrapped into 'cancellable_doc_iterator'
+///          in case if 'ctx' provides a cancellation token, 'it' otherwise
+//////////////////////////////////////////////////////////////////////////////
+inline doc_iterator::ptr make_cancellable(
+    doc_iterator::ptr&& it,
+    const attribute_provider* ctx) {
+  const auto* token = cancellation::extract(ctx);
+
+  if (!token || doc_limits::eof(it->value())) {
+    return std::move(it);
+  }
+
+  return doc_iterator::make<cancellable_doc_iterator>(std::move(it), *token);
+}
+
+NS_END // ROOT
+
+#endif // IRESEARCH_CANCELLATION_H
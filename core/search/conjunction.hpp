@@ -99,6 +99,9 @@ struct score_iterator_adapter {
 /// t |  ...    |
 ///   V  [n] <-- end
 ///-----------------------------------------------------------------------------
+/// the tail is reordered on the fly: iterator which rejects a candidate
+/// moves one step closer to the lead
+///-----------------------------------------------------------------------------
 ////////////////////////////////////////////////////////////////////////////////
 template<typename DocIterator>
 class conjunction
@@ -258,10 +261,19 @@ class conjunction
   doc_id_t seek_rest(doc_id_t target) {
     assert(!doc_limits::eof(target));
 
-    for (auto it = itrs_.begin()+1, end = itrs_.end(); it != end; ++it) {
+    const auto second = itrs_.begin() + 1;
+    for (auto it = second, end = itrs_.end(); it != end; ++it) {
       const auto doc = (*it)->seek(target);
 
       if (target < doc) {
+        // initial order is based on cost estimation only,
+        // move iterator rejecting the candidate one step closer
+        // to the lead, so the tail gradually adapts to the
+        // actual selectivity of its iterators
+        if (it != second) {
+          std::iter_swap(it, it - 1);
+        }
+
         return doc;
       }
     }
@@ -26,6 +26,8 @@
 #include <queue>
 
 #include "conjunction.hpp"
+#include "utils/bit_utils.hpp"
+#include "utils/math_utils.hpp"
 #include "utils/std.hpp"
 #include "utils/type_limits.hpp"
 #include "index/iterators.hpp"
@@ -500,6 +502,307 @@ class small_disjunction final
   order::prepared::merger merger_;
 }; // small_disjunction
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class block_disjunction
+/// @brief window based disjunction, drains all sub-iterators into a window of
+///        WINDOW documents along with accumulated scores and then emits
+///        matched documents in order, intended for disjunctions with many
+///        sub-iterators where heap maintenance becomes a bottleneck
+///        seeks beyond the current window don't fill a window, sub-iterators
+///        are just moved to the target, so that the disjunction stays cheap
+///        when driven by 'seek(...)', e.g. inside of a conjunction
+/// @note doesn't support visiting sub-iterators positioned at the current
+///       document since they're already moved beyond the window
+////////////////////////////////////////////////////////////////////////////////
+template<typename DocIterator, typename Adapter = score_iterator_adapter<DocIterator>>
+class block_disjunction final
+    : public frozen_attributes<3, doc_iterator>,
+      private score_ctx {
+ public:
+  typedef Adapter doc_iterator_t;
+  typedef std::vector<doc_iterator_t> doc_iterators_t;
+
+  static constexpr doc_id_t WINDOW = 2048;
+
+  block_disjunction(
+      doc_iterators_t&& itrs,
+      const order::prepared& ord,
+      sort::MergeType merge_type,
+      cost::cost_t est)
+    : block_disjunction(std::move(itrs), ord, merge_type, resolve_overload_tag()) {
+    cost_.value(est);
+  }
+
+  explicit block_disjunction(
+      doc_iterators_t&& itrs,
+      const order::prepared& ord = order::prepared::unordered(),
+      sort::MergeType merge_type = sort::MergeType::AGGREGATE)
+    : block_disjunction(std::move(itrs), ord, merge_type, resolve_overload_tag()) {
+    cost_.rule([this](){
+      return std::accumulate(
+        itrs_.begin(), itrs_.end(), cost::cost_t(0),
+        [](cost::cost_t lhs, const doc_iterator_t& rhs) {
+          return lhs + cost::extract(rhs, 0);
+      });
+    });
+  }
+
+  virtual doc_id_t value() const noexcept override {
+    return doc_.value;
+  }
+
+  virtual bool next() override {
+    if (doc_limits::eof(doc_.value)) {
+      return false;
+    }
+
+    if (!filled_ && doc_limits::valid(doc_.value)) {
+      // sub-iterators are positioned by the preceding 'seek(...)',
+      // move the ones matching the current document further
+      for (auto begin = itrs_.begin(); begin != itrs_.end(); ) {
+        auto& it = *begin;
+
+        if (it.value() == doc_.value && !it->next()) {
+          remove_iterator(it);
+          continue; // don't need to increment 'begin' here
+        }
+
+        ++begin;
+      }
+    }
+
+    while (!next_in_window()) {
+      if (!refill()) {
+        doc_.value = doc_limits::eof();
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  virtual doc_id_t seek(doc_id_t target) override {
+    if (target <= doc_.value || doc_limits::eof(doc_.value)) {
+      return doc_.value;
+    }
+
+    if (filled_ && target - base_ < WINDOW) {
+      // target is within the current window
+      cur_ = target - base_;
+      next();
+
+      return doc_.value;
+    }
+
+    // target is beyond the current window, move all sub-iterators to
+    // the target without draining them into a new window since the
+    // caller may be going to seek far beyond it anyway
+    doc_id_t min = doc_limits::eof();
+    for (auto begin = itrs_.begin(); begin != itrs_.end(); ) {
+      auto& it = *begin;
+
+      if (it.value() < target && doc_limits::eof(it->seek(target))) {
+        remove_iterator(it);
+        continue; // don't need to increment 'begin' here
+      }
+
+      min = std::min(min, it.value());
+      ++begin;
+    }
+
+    filled_ = false;
+    cur_ = WINDOW;
+    doc_.value = min;
+
+    return doc_.value;
+  }
+
+ private:
+  struct resolve_overload_tag{};
+
+  static constexpr size_t NUM_WORDS = WINDOW / bits_required<uint64_t>();
+
+  block_disjunction(
+      doc_iterators_t&& itrs,
+      const order::prepared& ord,
+      sort::MergeType merge_type,
+      resolve_overload_tag)
+    : attributes{{
+        { type<document>::id(), &doc_   },
+        { type<cost>::id(),     &cost_  },
+        { type<score>::id(),    &score_ },
+      }},
+      itrs_(std::move(itrs)),
+      doc_(itrs_.empty()
+        ? doc_limits::eof()
+        : doc_limits::invalid()),
+      merger_(ord.prepare_merger(merge_type)) {
+    prepare_score(ord);
+  }
+
+  void prepare_score(const order::prepared& ord) {
+    if (ord.empty()) {
+      return;
+    }
+
+    score_size_ = ord.score_size();
+    scores_.resize(WINDOW*score_size_);
+    scores_vals_.reserve(itrs_.size());
+    score_buf_.resize(score_size_);
+
+    score_.prepare(ord, this, [](const score_ctx* ctx, byte_type* score) {
+      auto& self = *static_cast<const block_disjunction*>(ctx);
+
+      if (!self.filled_) {
+        // document is reached by 'seek(...)', sub-iterators are positioned
+        self.score_at_doc(score);
+        return;
+      }
+
+      assert(self.doc_.value >= self.base_ && self.doc_.value - self.base_ < WINDOW);
+      const auto offset = self.doc_.value - self.base_;
+
+      if (self.scored_mask_[offset / bits_required<uint64_t>()]
+            & (uint64_t(1) << (offset % bits_required<uint64_t>()))) {
+        std::memcpy(score, self.scores_.c_str() + offset*self.score_size_,
+                    self.score_size_);
+      } else {
+        // document is matched by sub-iterators without scores only
+        const byte_type* none = nullptr;
+        self.merger_(score, &none, 0);
+      }
+    });
+  }
+
+  // @brief evaluates score of the current document from sub-iterators
+  //        positioned at it
+  void score_at_doc(byte_type* score) const {
+    scores_vals_.clear();
+
+    for (auto& it : itrs_) {
+      if (it.value() == doc_.value && !it.score->empty()) {
+        it.score->evaluate();
+        scores_vals_.emplace_back(it.score->c_str());
+      }
+    }
+
+    merger_(score, scores_vals_.data(), scores_vals_.size());
+  }
+
+  // @returns true if there is a next document in the current window
+  bool next_in_window() noexcept {
+    for (size_t i = cur_ / bits_required<uint64_t>(); cur_ < WINDOW; ) {
+      const auto word = mask_[i] >> (cur_ % bits_required<uint64_t>());
+
+      if (word) {
+        cur_ += doc_id_t(math::math_traits<uint64_t>::ctz(word));
+        doc_.value = base_ + cur_++;
+        return true;
+      }
+
+      cur_ = doc_id_t(++i * bits_required<uint64_t>());
+    }
+
+    return false;
+  }
+
+  // @brief drains all sub-iterators into the next window
+  // @returns false if all sub-iterators are exhausted
+  bool refill() {
+    // position all iterators at their first documents not yet in any window
+    doc_id_t min = doc_limits::eof();
+    for (auto begin = itrs_.begin(); begin != itrs_.end(); ) {
+      auto& it = *begin;
+
+      if (!doc_limits::valid(it.value()) && !it->next()) {
+        remove_iterator(it);
+        continue; // don't need to increment 'begin' here
+      }
+
+      min = std::min(min, it.value());
+      ++begin;
+    }
+
+    if (itrs_.empty()) {
+      return false;
+    }
+
+    base_ = min;
+    cur_ = 0;
+    filled_ = true;
+    std::memset(mask_, 0, sizeof mask_);
+    std::memset(scored_mask_, 0, sizeof scored_mask_);
+
+    for (auto begin = itrs_.begin(); begin != itrs_.end(); ) {
+      auto& it = *begin;
+      const bool scored = score_size_ && !it.score->empty();
+
+      for (auto doc = it.value(); doc - base_ < WINDOW; doc = it.value()) {
+        const auto offset = doc - base_;
+        const auto word = offset / bits_required<uint64_t>();
+        const auto bit = uint64_t(1) << (offset % bits_required<uint64_t>());
+
+        if (scored) {
+          it.score->evaluate();
+          merge_score(offset, it.score->c_str(), 0 != (scored_mask_[word] & bit));
+          scored_mask_[word] |= bit;
+        }
+
+        mask_[word] |= bit;
+
+        if (!it->next()) {
+          break;
+        }
+      }
+
+      if (doc_limits::eof(it.value())) {
+        remove_iterator(it);
+        continue; // don't need to increment 'begin' here
+      }
+
+      ++begin;
+    }
+
+    return true;
+  }
+
+  void merge_score(doc_id_t offset, const byte_type* score, bool merge) {
+    auto* dst = &scores_[offset*score_size_];
+
+    if (!merge) {
+      // the first score for a document in the window
+      std::memcpy(dst, score, score_size_);
+      return;
+    }
+
+    // merge function may reset destination before merging,
+    // so it's not allowed to alias any of the sources
+    const byte_type* srcs[] { dst, score };
+    merger_(&score_buf_[0], srcs, 2);
+    std::memcpy(dst, score_buf_.c_str(), score_size_);
+  }
+
+  void remove_iterator(doc_iterator_t& it) {
+    std::swap(it, itrs_.back());
+    itrs_.pop_back();
+  }
+
+  doc_iterators_t itrs_;
+  uint64_t mask_[NUM_WORDS]{}; // documents matched in the current window
+  uint64_t scored_mask_[NUM_WORDS]{}; // documents having accumulated scores
+  bstring scores_; // accumulated scores of documents in the current window
+  bstring score_buf_; // auxiliary buffer for merging scores
+  mutable std::vector<const byte_type*> scores_vals_; // scores merged after seek
+  size_t score_size_{};
+  doc_id_t base_{}; // the first document of the current window
+  doc_id_t cur_{WINDOW}; // offset of the next document in the current window
+  bool filled_{false}; // current document belongs to the current window
+  document doc_;
+  score score_;
+  cost cost_;
+  order::prepared::merger merger_;
+}; // block_disjunction
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @class disjunction
 /// @brief heap sort based disjunction
@@ -520,6 +823,7 @@ class disjunction final
   typedef small_disjunction<DocIterator, Adapter> small_disjunction_t;
   typedef basic_disjunction<DocIterator, Adapter> basic_disjunction_t;
   typedef unary_disjunction<DocIterator, Adapter> unary_disjunction_t;
+  typedef block_disjunction<DocIterator, Adapter> block_disjunction_t;
   typedef Adapter doc_iterator_t;
   typedef std::vector<doc_iterator_t> doc_iterators_t;
 
@@ -528,6 +832,11 @@ class disjunction final
 
   static constexpr bool ENABLE_UNARY = EnableUnary;
 
+  // block disjunction can't visit sub-iterators, so use it only
+  // for regular adapters which are never visited
+  static constexpr bool ENABLE_BLOCK = !EnableUnary
+    && std::is_same_v<Adapter, score_iterator_adapter<DocIterator>>;
+
   disjunction(
       doc_iterators_t&& itrs,
       const order::prepared& ord,
@@ -800,6 +1109,7 @@ doc_iterator::ptr make_disjunction(
   }
 
   constexpr size_t LINEAR_MERGE_UPPER_BOUND = 5;
+  constexpr size_t BLOCK_MERGE_LOWER_BOUND = 16;
   if (size <= LINEAR_MERGE_UPPER_BOUND) {
     typedef typename Disjunction::small_disjunction_t small_disjunction_t;
 
@@ -809,6 +1119,17 @@ doc_iterator::ptr make_disjunction(
       std::forward<Args>(args)...);
   }
 
+  if constexpr (Disjunction::ENABLE_BLOCK) {
+    if (size >= BLOCK_MERGE_LOWER_BOUND) {
+      typedef typename Disjunction::block_disjunction_t block_disjunction_t;
+
+      // block disjunction
+      return doc_iterator::make<block_disjunction_t>(
+        std::move(itrs),
+        std::forward<Args>(args)...);
+    }
+  }
+
   // disjunction
   return doc_iterator::make<Disjunction>(
     std::move(itrs),
@@ -47,8 +47,9 @@ struct IRESEARCH_API filter_visitor {
 
   //////////////////////////////////////////////////////////////////////////////
   /// @brief applies actions to a current term iterator
+  /// @returns false if the rest of the terms shouldn't be visited
   //////////////////////////////////////////////////////////////////////////////
-  virtual void visit(boost_t boost) = 0;
+  virtual bool visit(boost_t boost) = 0;
 }; // filter_visitor
 
 NS_END
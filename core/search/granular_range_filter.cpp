@@ -86,10 +86,39 @@ void collect_terms(
       break; // terminate traversal
     }
 
-    visitor.visit(irs::no_boost());
+    if (!visitor.visit(irs::no_boost())) {
+      break; // visitor asked to stop
+    }
   } while (terms.next());
 }
 
+// a granular range is collected as a number of sub-ranges, ensures the
+// wrapped visitor doesn't see any terms once it asked to stop
+template<typename Visitor>
+class stoppable_visitor {
+ public:
+  explicit stoppable_visitor(Visitor& visitor) noexcept
+    : visitor_(visitor) {
+  }
+
+  void prepare(
+      const irs::sub_reader& segment,
+      const irs::term_reader& field,
+      const irs::seek_term_iterator& terms) {
+    if (!stopped_) {
+      visitor_.prepare(segment, field, terms);
+    }
+  }
+
+  bool visit(irs::boost_t boost) {
+    return !stopped_ && !(stopped_ = !visitor_.visit(boost));
+  }
+
+ private:
+  Visitor& visitor_;
+  bool stopped_{false};
+}; // stoppable_visitor
+
 // collect all terms for a granularity range (min .. max), granularity level for max is ingored during comparison
 // null min/max are _always_ inclusive, i.e.: [null == current .. max), (min .. null == end of granularity range]
 template<typename Visitor>
@@ -469,7 +498,8 @@ void visit(
     const irs::sub_reader& segment,
     const irs::term_reader& reader,
     const irs::by_granular_range::options_type::range_type& rng,
-    Visitor& visitor) {
+    Visitor& field_visitor) {
+  stoppable_visitor<Visitor> visitor(field_visitor);
 
   auto terms = reader.iterator();
 
@@ -548,7 +578,8 @@ DEFINE_FACTORY_DEFAULT(by_granular_range)
     boost_t boost,
     const string_ref& field,
     const options_type::range_type& rng,
-    size_t scored_terms_limit) {
+    size_t scored_terms_limit,
+    const attribute_provider* ctx) {
   if (!rng.min.empty() && !rng.max.empty()) {
     const auto& min = rng.min.front();
     const auto& max = rng.max.front();
@@ -564,12 +595,17 @@ DEFINE_FACTORY_DEFAULT(by_granular_range)
     }
   }
 
+  const auto* token = cancellation::extract(ctx);
   limited_sample_collector<term_frequency> collector(ord.empty() ? 0 : scored_terms_limit); // object for collecting order stats
   granular_states states(index.size());
-  multiterm_visitor<granular_states> mtv(collector, states);
+  multiterm_visitor<granular_states> mtv(collector, states, token);
 
   // iterate over the segments
   for (const auto& segment: index) {
+    if (token && token->check()) {
+      break; // cancelled, use terms collected so far
+    }
+
     // get term dictionary for field
     const term_reader* reader = segment.field(field);
 
@@ -171,7 +171,9 @@ void visit(
       const auto utf8_value_size = static_cast<uint32_t>(utf8_utils::utf8_length(terms->value()));
       const auto boost = ::similarity(*distance, std::min(utf8_value_size, utf8_target_size));
 
-      visitor.visit(boost);
+      if (!visitor.visit(boost)) {
+        break;
+      }
     } while (terms->next());
   }
 }
@@ -182,6 +184,7 @@ bool collect_terms(
     const string_ref& field,
     const bytes_ref& term,
     const parametric_description& d,
+    const cancellation* token,
     Collector& collector) {
   const auto acceptor = make_levenshtein_automaton(d, term);
 
@@ -194,6 +197,10 @@ bool collect_terms(
   const byte_type max_distance = d.max_distance() + 1;
 
   for (auto& segment : index) {
+    if (token && token->check()) {
+      break; // cancelled, use terms collected so far
+    }
+
     auto* reader = segment.field(field);
 
     if (!reader) {
@@ -213,7 +220,9 @@ filter::prepared::ptr prepare_levenshtein_filter(
     const string_ref& field,
     const bytes_ref& term,
     size_t terms_limit,
-    const parametric_description& d) {
+    const parametric_description& d,
+    const attribute_provider* ctx) {
+  const auto* token = cancellation::extract(ctx);
   field_collectors field_stats(order);
   term_collectors term_stats(order, 1);
   multiterm_query::states_t states(index.size());
@@ -222,13 +231,13 @@ filter::prepared::ptr prepare_levenshtein_filter(
     all_terms_collector<decltype(states)> term_collector(states, field_stats, term_stats);
     term_collector.stat_index(0); // aggregate stats from different terms
 
-    if (!collect_terms(index, field, term, d, term_collector)) {
+    if (!collect_terms(index, field, term, d, token, term_collector)) {
       return filter::prepared::empty();
     }
   } else {
     top_terms_collector term_collector(terms_limit, field_stats);
 
-    if (!collect_terms(index, field, term, d, term_collector)) {
+    if (!collect_terms(index, field, term, d, token, term_collector)) {
       return filter::prepared::empty();
     }
 
@@ -315,7 +324,8 @@ DEFINE_FACTORY_DEFAULT(by_edit_distance)
     size_t scored_terms_limit,
     byte_type max_distance,
     options_type::pdp_f provider,
-    bool with_transpositions) {
+    bool with_transpositions,
+    const attribute_provider* ctx) {
   return executeLevenshtein(
     max_distance, provider, with_transpositions,
     []() -> filter::prepared::ptr {
@@ -324,9 +334,9 @@ DEFINE_FACTORY_DEFAULT(by_edit_distance)
     [&index, &order, boost, &field, &term]() -> filter::prepared::ptr {
       return by_term::prepare(index, order, boost, field, term);
     },
-    [&field, &term, scored_terms_limit, &index, &order, boost](
+    [&field, &term, scored_terms_limit, &index, &order, boost, ctx](
         const parametric_description& d) -> filter::prepared::ptr {
-      return prepare_levenshtein_filter(index, order, boost, field, term, scored_terms_limit, d);
+      return prepare_levenshtein_filter(index, order, boost, field, term, scored_terms_limit, d, ctx);
     }
   );
 }
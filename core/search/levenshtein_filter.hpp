@@ -119,7 +119,8 @@ class IRESEARCH_API by_edit_distance final
     size_t terms_limit,
     byte_type max_distance,
     options_type::pdp_f provider,
-    bool with_transpositions);
+    bool with_transpositions,
+    const attribute_provider* ctx = nullptr);
 
   static field_visitor visitor(
     const options_type::filter_options& options);
@@ -130,11 +131,11 @@ class IRESEARCH_API by_edit_distance final
       const index_reader& index,
       const order::prepared& order,
       boost_t boost,
-      const attribute_provider* /*ctx*/) const override {
+      const attribute_provider* ctx) const override {
     return prepare(index, order, this->boost()*boost,
                    field(), options().term, options().max_terms,
                    options().max_distance, options().provider,
-                   options().with_transpositions);
+                   options().with_transpositions, ctx);
   }
 }; // by_edit_distance
 
@@ -25,6 +25,7 @@
 
 #include "shared.hpp"
 #include "analysis/token_attributes.hpp"
+#include "search/cancellation.hpp"
 #include "search/collectors.hpp"
 #include "search/filter_visitor.hpp"
 #include "search/multiterm_query.hpp"
@@ -326,14 +327,19 @@ struct term_frequency {
 //////////////////////////////////////////////////////////////////////////////
 /// @class multiterm_visitor
 /// @brief filter visitor for multiterm queries
+/// @note stops term enumeration once the optional cancellation token fires
 //////////////////////////////////////////////////////////////////////////////
 template<typename States>
 class multiterm_visitor {
  public:
+  // number of visited terms between subsequent cancellation checks
+  static constexpr uint32_t CHECK_INTERVAL = 256;
+
   multiterm_visitor(
       limited_sample_collector<term_frequency>& collector,
-      States& states)
-    : collector_(collector), states_(states) {
+      States& states,
+      const cancellation* token = nullptr)
+    : collector_(collector), states_(states), token_(token) {
   }
 
   void prepare(
@@ -358,21 +364,37 @@ class multiterm_visitor {
   }
 
   // FIXME can incorporate boost into collecting logic
-  void visit(boost_t boost) {
+  bool visit(boost_t boost) {
+    if (interrupted_ ||
+        (token_ && 0 == (++visited_ % CHECK_INTERVAL) &&
+         (interrupted_ = token_->check()))) {
+      return false; // cancelled, stop visiting the rest of the terms
+    }
+
     // fill scoring candidates
     assert(docs_count_);
     key_.frequency = *docs_count_;
     key_.boost = boost;
     collector_.collect(key_);
     ++key_.offset;
+
+    return true;
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns true if term collection was cut short by a cancellation token
+  //////////////////////////////////////////////////////////////////////////////
+  bool interrupted() const noexcept { return interrupted_; }
+
  private:
   const decltype(term_meta::docs_count) no_docs_ = 0;
   limited_sample_collector<term_frequency>& collector_;
   States& states_;
   term_frequency key_;
   const decltype(term_meta::docs_count)* docs_count_ = nullptr;
+  const cancellation* token_;
+  uint32_t visited_{};
+  bool interrupted_{};
 }; // multiterm_visitor
 
 NS_END
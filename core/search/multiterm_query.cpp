@@ -25,13 +25,14 @@
 #include "shared.hpp"
 #include "bitset_doc_iterator.hpp"
 #include "disjunction.hpp"
+#include "cancellation.hpp"
 
 NS_ROOT
 
 doc_iterator::ptr multiterm_query::execute(
     const sub_reader& segment,
     const order::prepared& ord,
-    const attribute_provider* /*ctx*/) const {
+    const attribute_provider* ctx) const {
   typedef disjunction<doc_iterator::ptr> disjunction_t;
 
   // get term state for the specified reader
@@ -98,9 +99,11 @@ doc_iterator::ptr multiterm_query::execute(
     }
   }
 
-  return make_disjunction<disjunction_t>(
-    std::move(itrs), ord,
-    merge_type_, state->estimation());
+  return make_cancellable(
+    make_disjunction<disjunction_t>(
+      std::move(itrs), ord,
+      merge_type_, state->estimation()),
+    ctx);
 }
 
 NS_END // ROOT
@@ -135,24 +135,68 @@ class ngram_similarity_doc_iterator final
     const score* scr;
   };
 
+  // candidate sequence state, states of a single document are kept
+  // in a flat reusable buffer and reference their parents by index
   struct search_state {
-    search_state(size_t p, const score* s) : parent{nullptr}, scr{s}, pos{p}, len(1) {}
-    search_state(search_state&&) = default;
-    search_state(const search_state&) = default;
-    search_state& operator=(const search_state&) = default;
+    static constexpr size_t NO_PARENT = integer_traits<size_t>::const_max;
+
+    search_state(size_t p, const score* s) noexcept
+      : parent{NO_PARENT}, scr{s}, pos{p}, len{1} {}
 
     // appending constructor
-    search_state(std::shared_ptr<search_state>& other, size_t p, const score* s)
-      : parent{other}, scr{s}, pos{p}, len(other->len + 1) {}
+    search_state(size_t parent_idx, size_t parent_len,
+                 size_t p, const score* s) noexcept
+      : parent{parent_idx}, scr{s}, pos{p}, len{parent_len + 1} {}
 
-    std::shared_ptr<search_state> parent;
+    size_t parent; // index of the parent state in 'seq_states_'
     const score* scr;
     size_t pos;
     size_t len;
   };
 
-  using search_states_t = std::map<uint32_t, std::shared_ptr<search_state>, std::greater<uint32_t>>;
-  using pos_temp_t = std::vector<std::pair<uint32_t, std::shared_ptr<search_state>>>;
+  // candidate list entry: <position, index of the state in 'seq_states_'>,
+  // ordered by position in descending order
+  using search_entry_t = std::pair<uint32_t, size_t>;
+  using search_states_t = std::vector<search_entry_t>;
+
+  struct search_entry_less {
+    bool operator()(const search_entry_t& lhs, uint32_t rhs) const noexcept {
+      return lhs.first > rhs;
+    }
+    bool operator()(uint32_t lhs, const search_entry_t& rhs) const noexcept {
+      return lhs > rhs.first;
+    }
+  };
+
+  // @returns first candidate with position not greater than 'pos'
+  typename search_states_t::iterator lower_bound(uint32_t pos) {
+    return std::lower_bound(search_buf_.begin(), search_buf_.end(),
+                            pos, search_entry_less());
+  }
+
+  // @brief adds new candidate at a specified position unless there is
+  //        already one
+  // @returns true if candidate has been added
+  bool try_emplace(uint32_t pos, size_t state_idx) {
+    const auto it = lower_bound(pos);
+
+    if (it != search_buf_.end() && it->first == pos) {
+      return false;
+    }
+
+    search_buf_.emplace(it, pos, state_idx);
+    return true;
+  }
+
+  template<typename... Args>
+  size_t new_state(Args&&... args) {
+    seq_states_.emplace_back(std::forward<Args>(args)...);
+    return seq_states_.size() - 1;
+  }
+
+  bool is_used_pos(size_t pos) const {
+    return std::binary_search(used_pos_.begin(), used_pos_.end(), pos);
+  }
 
   bool check_serial_positions();
 
@@ -160,13 +204,15 @@ class ngram_similarity_doc_iterator final
   min_match_disjunction<DocIterator> approx_;
   document* doc_;
   frozen_attributes<5, attribute_provider> attrs_;
-  std::set<size_t> used_pos_; // longest sequence positions overlaping detector
+  std::vector<size_t> used_pos_; // longest sequence positions overlaping detector (sorted)
   std::vector<const score*> longest_sequence_;
   std::vector<size_t> pos_sequence_;
   frequency seq_freq_; // longest sequence frequency
   filter_boost filter_boost_;
   size_t min_match_count_;
-  search_states_t search_buf_;
+  search_states_t search_buf_; // reused between documents
+  std::vector<search_state> seq_states_; // reused between documents
+  search_states_t swap_cache_; // reused between documents
   const states_t& states_;
   size_t total_terms_count_;
   cost cost_;
@@ -177,9 +223,16 @@ class ngram_similarity_doc_iterator final
 template<typename DocIterator>
 bool ngram_similarity_doc_iterator<DocIterator>::check_serial_positions() {
   size_t potential = approx_.count_matched(); // how long max sequence could be in the best case
+  seq_freq_.value = 0;
+
+  if (potential < min_match_count_) {
+    // not enough terms matched, there is no need to touch positions
+    return false;
+  }
+
   search_buf_.clear();
+  seq_states_.clear();
   size_t longest_sequence_len = 0;
-  seq_freq_.value = 0;
   for (const auto& pos_iterator : pos_) {
     if (pos_iterator.doc->value == doc_->value) {
       position& pos = *(pos_iterator.pos);
@@ -187,26 +240,25 @@ bool ngram_similarity_doc_iterator<DocIterator>::check_serial_positions() {
         // this term could not start largest (or long enough) sequence.
         // skip it to first position to append to any existing candidates
         assert(!search_buf_.empty());
-        pos.seek(search_buf_.rbegin()->first + 1);
+        pos.seek(search_buf_.back().first + 1);
       } else {
         pos.next();
       }
       if (!pos_limits::eof(pos.value())) {
-        pos_temp_t swap_cache;
+        swap_cache_.clear();
         auto last_found_pos = pos_limits::invalid();
         do {
           auto current_pos = pos.value();
-          auto found = search_buf_.lower_bound(current_pos);
+          auto found = lower_bound(current_pos);
           if (found != search_buf_.end()) {
             if (last_found_pos != found->first) {
               last_found_pos = found->first;
-              const auto* found_state = found->second.get();
-              assert(found_state);
+              const auto* found_state = &seq_states_[found->second];
               auto current_sequence = found;
               // if we hit same position - set length to 0 to force checking candidates to the left
               size_t current_found_len = (found->first == current_pos ||
                                           found_state->scr == pos_iterator.scr) ? 0 : found_state->len + 1;
-              auto initial_found = found;
+              const auto initial_found_state = found->second;
               if (current_found_len > longest_sequence_len) {
                 longest_sequence_len = current_found_len;
               } else {
@@ -214,8 +266,7 @@ bool ngram_similarity_doc_iterator<DocIterator>::check_serial_positions() {
                 // lets go leftward and check if there are any candidates which could became longer
                 // if we stick this ngram to them rather than the closest one found
                 for (++found; found != search_buf_.end(); ++found) {
-                  found_state = found->second.get();
-                  assert(found_state);
+                  found_state = &seq_states_[found->second];
                   if (found_state->scr != pos_iterator.scr &&
                       found_state->len + 1 > current_found_len) {
                     // we have better option. Replace this match!
@@ -229,38 +280,35 @@ bool ngram_similarity_doc_iterator<DocIterator>::check_serial_positions() {
                 }
               }
               if (current_found_len) {
-                auto new_candidate = std::make_shared<search_state>(current_sequence->second, current_pos, pos_iterator.scr);
-                const auto res = search_buf_.try_emplace(current_pos, std::move(new_candidate));
-                if (!res.second) {
+                const auto parent_idx = current_sequence->second;
+                const auto new_candidate = new_state(parent_idx, seq_states_[parent_idx].len,
+                                                     current_pos, pos_iterator.scr);
+                if (!try_emplace(current_pos, new_candidate)) {
                   // pos already used. This could be if same ngram used several times.
                   // replace with new length through swap cache - to not spoil
                   // candidate for following positions of same ngram
-                  swap_cache.emplace_back(current_pos, std::move(new_candidate));
+                  swap_cache_.emplace_back(current_pos, new_candidate);
                 }
-              } else if (initial_found->second->scr == pos_iterator.scr &&
+              } else if (seq_states_[initial_found_state].scr == pos_iterator.scr &&
                          potential > longest_sequence_len && potential >= min_match_count_) {
                 // we just hit same iterator and found no better place to join,
                 // so it will produce new candidate
-                search_buf_.emplace(std::piecewise_construct,
-                  std::forward_as_tuple(current_pos),
-                  std::forward_as_tuple(std::make_shared<search_state>(current_pos, pos_iterator.scr)));
+                try_emplace(current_pos, new_state(current_pos, pos_iterator.scr));
               }
             }
           } else  if (potential > longest_sequence_len && potential >= min_match_count_) {
             // this ngram at this position  could potentially start a long enough sequence
             // so add it to candidate list
-            search_buf_.emplace(std::piecewise_construct,
-              std::forward_as_tuple(current_pos),
-              std::forward_as_tuple(std::make_shared<search_state>(current_pos, pos_iterator.scr)));
+            try_emplace(current_pos, new_state(current_pos, pos_iterator.scr));
             if (!longest_sequence_len) {
               longest_sequence_len = 1;
             }
           }
         } while (pos.next());
-        for (auto& p : swap_cache) {
-          auto res = search_buf_.find(p.first);
-          assert(res != search_buf_.end());
-          std::swap(res->second, p.second);
+        for (auto& p : swap_cache_) {
+          auto res = lower_bound(p.first);
+          assert(res != search_buf_.end() && res->first == p.first);
+          res->second = p.second;
         }
       }
       --potential; // we are done with this term.
@@ -286,8 +334,8 @@ bool ngram_similarity_doc_iterator<DocIterator>::check_serial_positions() {
     size_t count_longest{ 0 };
     // try to optimize case with one longest candidate
     // performance profiling shows it is majority of cases
-    for (auto i = search_buf_.begin(), end = search_buf_.end(); i != end; ++i) {
-      if (i->second->len == longest_sequence_len) {
+    for (auto& entry : search_buf_) {
+      if (seq_states_[entry.second].len == longest_sequence_len) {
         ++count_longest;
         if (count_longest > 1) {
           break;
@@ -300,50 +348,53 @@ bool ngram_similarity_doc_iterator<DocIterator>::check_serial_positions() {
       used_pos_.clear();
       longest_sequence_.reserve(longest_sequence_len);
       pos_sequence_.reserve(longest_sequence_len);
-      for (auto i = search_buf_.begin(), end = search_buf_.end(); i != end;) {
+      for (auto& entry : search_buf_) {
         pos_sequence_.clear();
-        const auto* state = i->second.get();
-        assert(state && state->len <= longest_sequence_len);
+        const auto* state = &seq_states_[entry.second];
+        assert(state->len <= longest_sequence_len);
         if (state->len == longest_sequence_len) {
           bool delete_candidate = false;
           // only first longest sequence will contribute to frequency
           if (longest_sequence_.empty()) {
             longest_sequence_.push_back(state->scr);
             pos_sequence_.push_back(state->pos);
-            auto cur_parent = state->parent;
-            while (cur_parent) {
-              longest_sequence_.push_back(cur_parent->scr);
-              pos_sequence_.push_back(cur_parent->pos);
-              cur_parent = cur_parent->parent;
+            for (auto parent = state->parent;
+                 parent != search_state::NO_PARENT;
+                 parent = seq_states_[parent].parent) {
+              longest_sequence_.push_back(seq_states_[parent].scr);
+              pos_sequence_.push_back(seq_states_[parent].pos);
             }
           } else {
-            if (used_pos_.find(state->pos) != used_pos_.end() ||
+            if (is_used_pos(state->pos) ||
                 state->scr != longest_sequence_[0]) {
               delete_candidate = true;
             } else {
               pos_sequence_.push_back(state->pos);
-              auto cur_parent = state->parent;
               size_t j = 1;
-              while (cur_parent) {
+              for (auto parent = state->parent;
+                   parent != search_state::NO_PARENT;
+                   parent = seq_states_[parent].parent, ++j) {
+                const auto& cur_parent = seq_states_[parent];
                 assert(j < longest_sequence_.size());
-                if (longest_sequence_[j] != cur_parent->scr ||
-                  used_pos_.find(cur_parent->pos) != used_pos_.end()) {
+                if (longest_sequence_[j] != cur_parent.scr ||
+                    is_used_pos(cur_parent.pos)) {
                   delete_candidate = true;
                   break;
                 }
-                pos_sequence_.push_back(cur_parent->pos);
-                cur_parent = cur_parent->parent;
-                ++j;
+                pos_sequence_.push_back(cur_parent.pos);
               }
             }
           }
           if (!delete_candidate) {
             ++freq;
-            used_pos_.insert(std::begin(pos_sequence_),
-                            std::end(pos_sequence_));
+            for (auto p : pos_sequence_) {
+              const auto it = std::lower_bound(used_pos_.begin(), used_pos_.end(), p);
+              if (it == used_pos_.end() || *it != p) {
+                used_pos_.insert(it, p);
+              }
+            }
           }
         }
-        ++i;
       }
     } else {
       freq = 1;
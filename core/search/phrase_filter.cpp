@@ -210,7 +210,7 @@ class phrase_term_visitor final : public filter_visitor,
     found_ = true;
   }
 
-  virtual void visit(boost_t boost) override {
+  virtual bool visit(boost_t boost) override {
     assert(terms_ && collectors_ && segment_ && reader_);
 
     // disallow negative boost
@@ -226,6 +226,8 @@ class phrase_term_visitor final : public filter_visitor,
 
     collectors_->collect(*segment_, *reader_, term_offset_++, *terms_);
     phrase_states_.emplace_back(terms_->cookie(), boost);
+
+    return true;
   }
 
   void reset() noexcept {
@@ -325,6 +327,9 @@ class fixed_phrase_query : public phrase_query<fixed_phrase_state> {
     std::vector<fixed_phrase_frequency::term_position_t> positions;
     positions.reserve(phrase_state->terms.size());
 
+    std::vector<std::pair<cost::cost_t, size_t>> order; // <cost, term index>
+    order.reserve(phrase_state->terms.size());
+
     // find term using cached state
     auto terms = phrase_state->reader->iterator();
     auto position = positions_.begin();
@@ -347,6 +352,7 @@ class fixed_phrase_query : public phrase_query<fixed_phrase_state> {
         return doc_iterator::empty();
       }
 
+      order.emplace_back(cost::extract(*docs), positions.size());
       positions.emplace_back(std::ref(*pos), *position);
 
       // add base iterator
@@ -355,9 +361,21 @@ class fixed_phrase_query : public phrase_query<fixed_phrase_state> {
       ++position;
     }
 
+    // verify positions starting from the rarest term
+    std::stable_sort(order.begin(), order.end(),
+                     [](const auto& lhs, const auto& rhs) noexcept {
+      return lhs.first < rhs.first;
+    });
+
+    std::vector<fixed_phrase_frequency::term_position_t> ordered_positions;
+    ordered_positions.reserve(positions.size());
+    for (auto& entry : order) {
+      ordered_positions.emplace_back(positions[entry.second]);
+    }
+
     return memory::make_shared<phrase_iterator_t>(
       std::move(itrs),
-      std::move(positions),
+      std::move(ordered_positions),
       rdr,
       *phrase_state->reader,
       stats_.c_str(),
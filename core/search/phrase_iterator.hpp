@@ -33,12 +33,14 @@ class fixed_phrase_frequency {
     position::ref, // position attribute
     position::value_t>; // desired offset in the phrase
 
+  // positions are expected to be ordered by the estimated cost of the
+  // corresponding terms, i.e. the rarest term goes first and is used
+  // as a lead, any term may be a lead
   fixed_phrase_frequency(
       std::vector<term_position_t>&& pos,
       const order::prepared& ord)
     : pos_(std::move(pos)), order_empty_(ord.empty()) {
     assert(!pos_.empty()); // must not be empty
-    assert(0 == pos_.front().second); // lead offset is always 0
   }
 
   frequency* freq() noexcept {
@@ -55,29 +57,35 @@ class fixed_phrase_frequency {
     bool match;
 
     position& lead = pos_.front().first;
+    const position::value_t lead_offset = pos_.front().second;
     lead.next();
 
     for (auto end = pos_.end(); !pos_limits::eof(lead.value());) {
-      const position::value_t base_position = lead.value();
+      if (lead.value() <= lead_offset) {
+        // phrase can't start before the very first position
+        lead.seek(lead_offset + pos_limits::min());
+        continue;
+      }
+
+      const position::value_t base_position = lead.value() - lead_offset;
 
       match = true;
 
       for (auto it = pos_.begin() + 1; it != end; ++it) {
         position& pos = it->first;
         const auto term_position = base_position + it->second;
-        if (!pos_limits::valid(term_position)) {
-          return phrase_freq_.value;
-        }
+        assert(pos_limits::valid(term_position));
         const auto sought = pos.seek(term_position);
 
         if (pos_limits::eof(sought)) {
           // exhausted
           return phrase_freq_.value;
-        } else if (sought!= term_position) {
-          // sought too far from the lead
+        } else if (sought != term_position) {
+          // sought too far from the lead, there is no need
+          // to read positions of the remaining terms
           match = false;
 
-          lead.seek(sought- it->second);
+          lead.seek(sought - it->second + lead_offset);
           break;
         }
       }
@@ -53,9 +53,7 @@ void visit(
     visitor.prepare(segment, reader, *terms);
 
     do {
-      visitor.visit(no_boost());
-
-      if (!terms->next()) {
+      if (!visitor.visit(no_boost()) || !terms->next()) {
         break;
       }
 
@@ -76,13 +74,19 @@ DEFINE_FACTORY_DEFAULT(by_prefix)
     boost_t boost,
     const string_ref& field,
     const bytes_ref& prefix,
-    size_t scored_terms_limit) {
+    size_t scored_terms_limit,
+    const attribute_provider* ctx) {
+  const auto* token = cancellation::extract(ctx);
   limited_sample_collector<term_frequency> collector(ord.empty() ? 0 : scored_terms_limit); // object for collecting order stats
   multiterm_query::states_t states(index.size());
-  multiterm_visitor<multiterm_query::states_t> mtv(collector, states);
+  multiterm_visitor<multiterm_query::states_t> mtv(collector, states, token);
 
   // iterate over the segments
   for (const auto& segment: index) {
+    if (token && token->check()) {
+      break; // cancelled, use terms collected so far
+    }
+
     // get term dictionary for field
     const auto* reader = segment.field(field);
 
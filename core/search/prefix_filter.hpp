@@ -87,7 +87,8 @@ class IRESEARCH_API by_prefix : public filter_base<by_prefix_options> {
     boost_t boost,
     const string_ref& field,
     const bytes_ref& prefix,
-    size_t scored_terms_limit);
+    size_t scored_terms_limit,
+    const attribute_provider* ctx = nullptr);
 
   static void visit(
     const sub_reader& segment,
@@ -101,10 +102,10 @@ class IRESEARCH_API by_prefix : public filter_base<by_prefix_options> {
       const index_reader& index,
       const order::prepared& ord,
       boost_t boost,
-      const attribute_provider* /*ctx*/) const override {
+      const attribute_provider* ctx) const override {
     return prepare(index, ord, this->boost()*boost,
                    field(), options().term,
-                   options().scored_terms_limit);
+                   options().scored_terms_limit, ctx);
   }
 }; // by_prefix
 
@@ -49,9 +49,7 @@ void collect_terms(
     visitor.prepare(segment, field, terms);
 
     do {
-      visitor.visit(no_boost());
-
-      if (!terms.next()) {
+      if (!visitor.visit(no_boost()) || !terms.next()) {
         break;
       }
 
@@ -129,7 +127,8 @@ DEFINE_FACTORY_DEFAULT(by_range)
     boost_t boost,
     const string_ref& field,
     const options_type::range_type& rng,
-    size_t scored_terms_limit) {
+    size_t scored_terms_limit,
+    const attribute_provider* ctx) {
   //TODO: optimize unordered case
   // - seek to min
   // - get ordinal position of the term
@@ -149,12 +148,17 @@ DEFINE_FACTORY_DEFAULT(by_range)
     return prepared::empty();
   }
 
+  const auto* token = cancellation::extract(ctx);
   limited_sample_collector<term_frequency> collector(ord.empty() ? 0 : scored_terms_limit); // object for collecting order stats
   multiterm_query::states_t states(index.size());
-  multiterm_visitor<multiterm_query::states_t> mtv(collector, states);
+  multiterm_visitor<multiterm_query::states_t> mtv(collector, states, token);
 
   // iterate over the segments
   for (const auto& segment : index) {
+    if (token && token->check()) {
+      break; // cancelled, use terms collected so far
+    }
+
     // get term dictionary for field
     const auto* reader = segment.field(field);
 
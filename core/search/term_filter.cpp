@@ -53,7 +53,7 @@ class term_visitor : private util::noncopyable {
     terms_ = &terms;
   }
 
-  void visit(boost_t /*boost*/) {
+  bool visit(boost_t /*boost*/) {
     // collect statistics
     assert(segment_ && reader_ && terms_);
     term_stats_.collect(*segment_, *reader_, 0, *terms_);
@@ -64,6 +64,8 @@ class term_visitor : private util::noncopyable {
     auto& state = states_.insert(*segment_);
     state.reader = reader_;
     state.cookie = terms_->cookie();
+
+    return true;
   }
 
  private:
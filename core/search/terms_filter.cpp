@@ -54,7 +54,9 @@ void visit(
 
     terms->read();
 
-    visitor.visit(term.boost);
+    if (!visitor.visit(term.boost)) {
+      break;
+    }
   }
 }
 
@@ -73,10 +75,11 @@ class terms_visitor {
     collector_.stat_index(0);
   }
 
-  void visit(boost_t boost) {
+  bool visit(boost_t boost) {
     size_t stat_index = collector_.stat_index();
-    collector_.visit(boost);
+    const bool more = collector_.visit(boost);
     collector_.stat_index(++stat_index);
+    return more;
   }
 
  private:
@@ -181,8 +181,9 @@ template<typename State,
 
   //////////////////////////////////////////////////////////////////////////////
   /// @brief collect current term
+  /// @returns true, all terms of a field are to be visited
   //////////////////////////////////////////////////////////////////////////////
-  void visit(const key_type& key) {
+  bool visit(const key_type& key) {
     const auto& term = *state_.term;
 
     if (terms_.size() < size_) {
@@ -195,7 +196,7 @@ template<typename State,
 
       res.first->second.emplace(state_);
 
-      return;
+      return true;
     }
 
     const auto min = heap_.front();
@@ -203,7 +204,7 @@ template<typename State,
 
     if (!comparer()(min_state, key, term)) {
       // nothing to do
-      return;
+      return true;
     }
 
     const auto hashed_term = make_hashed_ref(term);
@@ -225,6 +226,8 @@ template<typename State,
       // update existing entry
       it->second.emplace(state_);
     }
+
+    return true;
   }
 
   //FIXME rename
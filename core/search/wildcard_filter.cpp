@@ -160,7 +160,8 @@ field_visitor by_wildcard::visitor(const bytes_ref& term) {
     boost_t boost,
     const string_ref& field,
     const bytes_ref& term,
-    size_t scored_terms_limit) {
+    size_t scored_terms_limit,
+    const attribute_provider* ctx) {
   bstring buf;
   return executeWildcard(
     buf, term,
@@ -170,12 +171,12 @@ field_visitor by_wildcard::visitor(const bytes_ref& term) {
     [&index, &order, boost, &field](const bytes_ref& term) -> filter::prepared::ptr {
       return by_term::prepare(index, order, boost, field, term);
     },
-    [&index, &order, boost, &field, scored_terms_limit](const bytes_ref& term) -> filter::prepared::ptr {
-      return by_prefix::prepare(index, order, boost, field, term, scored_terms_limit);
+    [&index, &order, boost, &field, scored_terms_limit, ctx](const bytes_ref& term) -> filter::prepared::ptr {
+      return by_prefix::prepare(index, order, boost, field, term, scored_terms_limit, ctx);
     },
-    [&index, &order, boost, &field, scored_terms_limit](const bytes_ref& term) -> filter::prepared::ptr {
+    [&index, &order, boost, &field, scored_terms_limit, ctx](const bytes_ref& term) -> filter::prepared::ptr {
       return prepare_automaton_filter(field, from_wildcard(term), scored_terms_limit,
-                                      index, order, boost);
+                                      index, order, boost, ctx);
     }
   );
 }
@@ -88,7 +88,8 @@ class IRESEARCH_API by_wildcard final
     boost_t boost,
     const string_ref& field,
     const bytes_ref& term,
-    size_t scored_terms_limit);
+    size_t scored_terms_limit,
+    const attribute_provider* ctx = nullptr);
 
   static field_visitor visitor(const bytes_ref& term);
 
@@ -98,10 +99,10 @@ class IRESEARCH_API by_wildcard final
       const index_reader& index,
       const order::prepared& order,
       boost_t boost,
-      const attribute_provider* /*ctx*/) const override {
+      const attribute_provider* ctx) const override {
     return prepare(index, order, this->boost()*boost,
                    field(), options().term,
-                   options().scored_terms_limit);
+                   options().scored_terms_limit, ctx);
   }
 }; // by_wildcard
 
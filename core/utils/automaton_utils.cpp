@@ -295,7 +295,8 @@ filter::prepared::ptr prepare_automaton_filter(
     size_t scored_terms_limit,
     const index_reader& index,
     const order::prepared& order,
-    boost_t boost) {
+    boost_t boost,
+    const attribute_provider* ctx) {
   auto matcher = make_automaton_matcher(acceptor);
 
   if (fst::kError == matcher.Properties(0)) {
@@ -306,11 +307,16 @@ filter::prepared::ptr prepare_automaton_filter(
     return filter::prepared::empty();
   }
 
+  const auto* token = cancellation::extract(ctx);
   limited_sample_collector<term_frequency> collector(order.empty() ? 0 : scored_terms_limit); // object for collecting order stats
   multiterm_query::states_t states(index.size());
-  multiterm_visitor<multiterm_query::states_t> mtv(collector, states);
+  multiterm_visitor<multiterm_query::states_t> mtv(collector, states, token);
 
   for (const auto& segment : index) {
+    if (token && token->check()) {
+      break; // cancelled, use terms collected so far
+    }
+
     // get term dictionary for field
     const auto* reader = segment.field(field);
 
@@ -417,7 +417,9 @@ void visit(
     do {
       terms->read();
 
-      visitor.visit(no_boost());
+      if (!visitor.visit(no_boost())) {
+        break;
+      }
     } while (terms->next());
   }
 }
@@ -462,6 +464,7 @@ IRESEARCH_API void utf8_emplace_rho_arc(
 /// @param index index reader
 /// @param order compiled order
 /// @param bool query boost
+/// @param ctx query context, may provide a cancellation token
 /// @returns compiled filter
 //////////////////////////////////////////////////////////////////////////////
 IRESEARCH_API filter::prepared::ptr prepare_automaton_filter(
@@ -470,7 +473,8 @@ IRESEARCH_API filter::prepared::ptr prepare_automaton_filter(
   size_t scored_terms_limit,
   const index_reader& index,
   const order::prepared& order,
-  boost_t boost);
+  boost_t boost,
+  const attribute_provider* ctx = nullptr);
 
 NS_END
 
@@ -47,11 +47,42 @@ NS_END
 
 NS_ROOT
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                             cipher implementation
+// -----------------------------------------------------------------------------
+
+bool cipher::encrypt_blocks(byte_type* data, size_t count) const {
+  const auto block_size = this->block_size();
+
+  for (; count; --count, data += block_size) {
+    if (!encrypt(data)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool cipher::decrypt_blocks(byte_type* data, size_t count) const {
+  const auto block_size = this->block_size();
+
+  for (; count; --count, data += block_size) {
+    if (!decrypt(data)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///// @class ctr_cipher_stream
 ////////////////////////////////////////////////////////////////////////////////
 class ctr_cipher_stream : public encryption::stream {
  public:
+  // size of the on-stack buffer for a batch of keystream blocks
+  static constexpr size_t KEYSTREAM_BUFFER_SIZE = 1024;
+
   explicit ctr_cipher_stream(
       const cipher& cipher,
       const bytes_ref& iv,
@@ -71,126 +102,84 @@ class ctr_cipher_stream : public encryption::stream {
   virtual bool decrypt(uint64_t offset, byte_type* data, size_t size) override;
 
  private:
-  bool encrypt_block(uint64_t block_index, byte_type* data, byte_type* scratch);
-
-  bool decrypt_block(uint64_t block_index, byte_type* data, byte_type* scratch);
+  // generates keystream for 'count' blocks starting from 'block_index'
+  bool keystream(uint64_t block_index, byte_type* buf, size_t count) const;
 
   const cipher* cipher_;
   bstring iv_;
   uint64_t counter_base_;
 }; // ctr_cipher_stream
 
-bool ctr_cipher_stream::encrypt(uint64_t offset, byte_type* data, size_t size) {
+bool ctr_cipher_stream::keystream(
+    uint64_t block_index,
+    byte_type* buf,
+    size_t count) const {
   const auto block_size = this->block_size();
-  assert(block_size);
-  uint64_t block_index = offset / block_size;
-  size_t block_offset = offset % block_size;
-
-  bstring block_buf;
-  bstring scratch(block_size, 0);
-
-  // encrypt block by block
-  while (true) {
-    byte_type* block = data;
-    const size_t n = std::min(size, block_size - block_offset);
-
-    if (n != block_size) {
-      block_buf.resize(block_size);
-      block = &block_buf[0];
-      std::memmove(block + block_offset, data, n);
-    }
-
-    if (!encrypt_block(block_index, block, &scratch[0])) {
-      return false;
-    }
-
-    if (block != data) {
-      std::memmove(data, block + block_offset, n);
-    }
-
-    size -= n;
-
-    if (!size) {
-      return true;
-    }
-
-    data += n;
-    block_offset = 0;
-    ++block_index;
+  const size_t counter_size = std::min(sizeof(uint64_t), block_size);
+
+  // init nonce + counter for each block
+  for (auto* block = buf, *end = buf + count*block_size;
+       block != end;
+       block += block_size, ++block_index) {
+    byte_type counter[sizeof(uint64_t)];
+    auto* begin = counter;
+    irs::write<uint64_t>(begin, counter_base_ + block_index);
+
+    std::memcpy(block, iv_.c_str(), block_size);
+    std::memcpy(block, counter, counter_size);
   }
+
+  // encrypt nonce + counter of the whole batch at once
+  return cipher_->encrypt_blocks(buf, count);
 }
 
-bool ctr_cipher_stream::decrypt(uint64_t offset, byte_type* data, size_t size) {
+bool ctr_cipher_stream::encrypt(uint64_t offset, byte_type* data, size_t size) {
   const auto block_size = this->block_size();
   assert(block_size);
   uint64_t block_index = offset / block_size;
   size_t block_offset = offset % block_size;
 
-  bstring block_buf;
-  bstring scratch(block_size, 0);
-
-  // decrypt block by block
-  while (true) {
-    byte_type* block = data;
-    const size_t n = std::min(size, block_size - block_offset);
+  // keystream is generated in batches of blocks, the buffer is allocated
+  // on heap only for ciphers with unusually large blocks
+  byte_type stack_buf[KEYSTREAM_BUFFER_SIZE];
+  std::unique_ptr<byte_type[]> heap_buf;
+  byte_type* buf = stack_buf;
+  size_t batch_size = KEYSTREAM_BUFFER_SIZE / block_size;
+
+  if (!batch_size) {
+    heap_buf = memory::make_unique<byte_type[]>(block_size);
+    buf = heap_buf.get();
+    batch_size = 1;
+  }
 
-    if (n != block_size) {
-      block_buf.resize(block_size, 0);
-      block = &block_buf[0];
-      std::memmove(block + block_offset, data, n);
-    }
+  while (size) {
+    const size_t count = std::min(
+      batch_size,
+      (block_offset + size + block_size - 1) / block_size);
 
-    if (!decrypt_block(block_index, block, &scratch[0])) {
+    if (!keystream(block_index, buf, count)) {
       return false;
     }
 
-    if (block != data) {
-      std::memmove(data, block + block_offset, n);
-    }
-
-    size -= n;
-
-    if (!size) {
-      return true;
+    // XOR data with keystream
+    const size_t n = std::min(size, count*block_size - block_offset);
+    const auto* key = buf + block_offset;
+    for (size_t i = 0; i < n; ++i) {
+      data[i] ^= key[i];
     }
 
     data += n;
+    size -= n;
+    block_index += count;
     block_offset = 0;
-    ++block_index;
-  }
-}
-
-bool ctr_cipher_stream::encrypt_block(
-    uint64_t block_index,
-    byte_type* data,
-    byte_type* scratch
-) {
-  // init nonce + counter
-  const auto block_size = this->block_size();
-  std::memmove(scratch, iv_.c_str(), block_size);
-  auto* begin = scratch;
-  irs::write<uint64_t>(begin, counter_base_ + block_index);
-
-  // encrypt nonce + counter
-  if (!cipher_->encrypt(scratch)) {
-    return false;
-  }
-
-  // XOR data with ciphertext
-  for (size_t i = 0; i < block_size; ++i) {
-    data[i] ^= scratch[i];
   }
 
   return true;
 }
 
-bool ctr_cipher_stream::decrypt_block(
-    uint64_t block_index,
-    byte_type* data,
-    byte_type* scratch
-) {
+bool ctr_cipher_stream::decrypt(uint64_t offset, byte_type* data, size_t size) {
   // for CTR decryption and encryption are the same
-  return encrypt_block(block_index, data, scratch);
+  return encrypt(offset, data, size);
 }
 
 // -----------------------------------------------------------------------------
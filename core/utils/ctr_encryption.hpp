@@ -38,6 +38,20 @@ struct IRESEARCH_API cipher {
   virtual bool encrypt(byte_type* data) const = 0;
 
   virtual bool decrypt(byte_type* data) const = 0;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief encrypts 'count' consecutive blocks in place, implementations
+  ///        may override it to process independent blocks in a pipelined
+  ///        fashion (e.g. AES-NI), default implementation encrypts blocks
+  ///        one by one
+  //////////////////////////////////////////////////////////////////////////////
+  virtual bool encrypt_blocks(byte_type* data, size_t count) const;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief decrypts 'count' consecutive blocks in place
+  /// @see encrypt_blocks
+  //////////////////////////////////////////////////////////////////////////////
+  virtual bool decrypt_blocks(byte_type* data, size_t count) const;
 }; // cipher
 
 ////////////////////////////////////////////////////////////////////////////////
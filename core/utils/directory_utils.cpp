@@ -25,8 +25,109 @@
 #include "index/index_meta.hpp"
 #include "formats/formats.hpp"
 #include "utils/attributes.hpp"
+#include "utils/bytes_utils.hpp"
 #include "utils/log.hpp"
 
+#include <thread>
+
+NS_LOCAL
+
+// number of bytes written to an output between consecutive pauses
+constexpr size_t PAUSE_THRESHOLD = 64 * 1024;
+
+// don't sleep for a shorter period, pay the debt with the subsequent writes
+constexpr std::chrono::milliseconds MIN_PAUSE(1);
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class rate_limited_output
+/// @brief accounts written bytes in a rate_limiter in chunks of
+///        'PAUSE_THRESHOLD' bytes and on flush/close
+//////////////////////////////////////////////////////////////////////////////
+class rate_limited_output final : public irs::index_output {
+ public:
+  rate_limited_output(
+      irs::index_output::ptr&& impl,
+      irs::rate_limiter& limiter) noexcept
+    : impl_(std::move(impl)),
+      limiter_(&limiter),
+      accounted_(impl_->file_pointer()) {
+  }
+
+  virtual void close() override {
+    const auto file_pointer = impl_->file_pointer(); // may be reset by close()
+    impl_->close();
+    pause(file_pointer);
+  }
+
+  virtual void flush() override {
+    impl_->flush();
+    pause(impl_->file_pointer());
+  }
+
+  virtual size_t file_pointer() const override {
+    return impl_->file_pointer();
+  }
+
+  virtual int64_t checksum() const override {
+    return impl_->checksum();
+  }
+
+  virtual void write_byte(irs::byte_type b) override {
+    impl_->write_byte(b);
+    account(1);
+  }
+
+  virtual void write_bytes(const irs::byte_type* b, size_t len) override {
+    impl_->write_bytes(b, len);
+    account(len);
+  }
+
+  virtual void write_int(int32_t v) override {
+    impl_->write_int(v);
+    account(sizeof(uint32_t));
+  }
+
+  virtual void write_long(int64_t v) override {
+    impl_->write_long(v);
+    account(sizeof(uint64_t));
+  }
+
+  virtual void write_vint(uint32_t v) override {
+    impl_->write_vint(v);
+    account(irs::bytes_io<uint32_t>::const_max_vsize); // exact size is taken from the file pointer
+  }
+
+  virtual void write_vlong(uint64_t v) override {
+    impl_->write_vlong(v);
+    account(irs::bytes_io<uint64_t>::const_max_vsize); // exact size is taken from the file pointer
+  }
+
+ private:
+  void account(size_t size) {
+    pending_ += size;
+
+    if (pending_ >= PAUSE_THRESHOLD) {
+      pause(impl_->file_pointer());
+    }
+  }
+
+  void pause(size_t file_pointer) {
+    pending_ = 0;
+
+    if (file_pointer > accounted_) {
+      limiter_->pause(file_pointer - accounted_);
+      accounted_ = file_pointer;
+    }
+  }
+
+  irs::index_output::ptr impl_;
+  irs::rate_limiter* limiter_;
+  size_t accounted_; // file pointer accounted in 'limiter_' so far
+  size_t pending_{}; // upper bound of bytes written since the last pause
+}; // rate_limited_output
+
+NS_END
+
 NS_ROOT
 NS_BEGIN(directory_utils)
 
@@ -250,6 +351,88 @@ directory_cleaner::removal_acceptor_t remove_except_current_segments(
 
 NS_END
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                      rate_limiter
+// -----------------------------------------------------------------------------
+
+rate_limiter::rate_limiter(uint64_t bytes_per_sec /*= 0*/) noexcept
+  : start_(clock_t::now()),
+    bytes_per_sec_(bytes_per_sec),
+    next_(start_) {
+}
+
+void rate_limiter::pause(uint64_t size) {
+  bytes_.fetch_add(size, std::memory_order_relaxed);
+
+  const auto rate = bytes_per_sec();
+
+  if (!rate || !size) {
+    return; // unlimited
+  }
+
+  const auto delay = std::chrono::duration_cast<clock_t::duration>(
+    std::chrono::duration<double>(double(size) / double(rate))
+  );
+  clock_t::time_point until;
+
+  {
+    SCOPED_LOCK(mutex_);
+    // the budget isn't accumulated while there are no writes,
+    // concurrent writers queue up one after another
+    next_ = std::max(next_, clock_t::now()) + delay;
+    until = next_;
+  }
+
+  const auto now = clock_t::now();
+
+  if (until - now < MIN_PAUSE) {
+    return;
+  }
+
+  std::this_thread::sleep_until(until);
+
+  paused_.fetch_add(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(clock_t::now() - now).count(),
+    std::memory_order_relaxed
+  );
+}
+
+double rate_limiter::throughput() const noexcept {
+  const std::chrono::duration<double> elapsed = clock_t::now() - start_;
+
+  return elapsed.count() > 0. ? double(bytes()) / elapsed.count() : 0.;
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                            rate_limited_directory
+// -----------------------------------------------------------------------------
+
+rate_limited_directory::rate_limited_directory(
+    directory& impl,
+    rate_limiter::ptr limiter
+) noexcept
+  : impl_(impl),
+    limiter_(std::move(limiter)) {
+}
+
+index_output::ptr rate_limited_directory::create(
+  const std::string& name
+) noexcept {
+  auto result = impl_.create(name);
+
+  if (!result || !limiter_) {
+    return result;
+  }
+
+  try {
+    return index_output::make<rate_limited_output>(std::move(result), *limiter_);
+  } catch (...) {
+    IR_LOG_EXCEPTION();
+  }
+
+  return nullptr;
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                                tracking_directory
 // -----------------------------------------------------------------------------
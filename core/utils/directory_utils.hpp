@@ -24,11 +24,17 @@
 #ifndef IRESEARCH_DIRECTORY_UTILS_H
 #define IRESEARCH_DIRECTORY_UTILS_H
 
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
 #include "shared.hpp"
 #include "store/data_input.hpp"
 #include "store/data_output.hpp"
 #include "store/directory.hpp"
 #include "store/directory_cleaner.hpp"
+#include "utils/memory.hpp"
+#include "utils/noncopyable.hpp"
 
 NS_ROOT
 
@@ -260,6 +266,151 @@ struct IRESEARCH_API ref_tracking_directory: public directory {
   IRESEARCH_API_PRIVATE_VARIABLES_END
 }; // ref_tracking_directory
 
+//////////////////////////////////////////////////////////////////////////////
+/// @class rate_limiter
+/// @brief paces writes to a budget of bytes per second, a single instance
+///        may be shared by multiple writers, e.g. by all running merges
+//////////////////////////////////////////////////////////////////////////////
+class IRESEARCH_API rate_limiter : private util::noncopyable {
+ public:
+  DECLARE_SHARED_PTR(rate_limiter);
+
+  // @param bytes_per_sec budget, 0 == unlimited
+  explicit rate_limiter(uint64_t bytes_per_sec = 0) noexcept;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief adjusts the budget, may be called concurrently with 'pause(...)'
+  /// @param value bytes per second, 0 == unlimited
+  //////////////////////////////////////////////////////////////////////////////
+  void bytes_per_sec(uint64_t value) noexcept {
+    bytes_per_sec_.store(value, std::memory_order_relaxed);
+  }
+
+  uint64_t bytes_per_sec() const noexcept {
+    return bytes_per_sec_.load(std::memory_order_relaxed);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @brief accounts 'size' written bytes and blocks the caller for as long
+  ///        as it's necessary to stay within the budget
+  //////////////////////////////////////////////////////////////////////////////
+  void pause(uint64_t size);
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns total number of bytes accounted so far
+  //////////////////////////////////////////////////////////////////////////////
+  uint64_t bytes() const noexcept {
+    return bytes_.load(std::memory_order_relaxed);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns total time the writers spent paused
+  //////////////////////////////////////////////////////////////////////////////
+  std::chrono::nanoseconds paused() const noexcept {
+    return std::chrono::nanoseconds(paused_.load(std::memory_order_relaxed));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// @returns achieved throughput in bytes per second since creation
+  //////////////////////////////////////////////////////////////////////////////
+  double throughput() const noexcept;
+
+ private:
+  typedef std::chrono::steady_clock clock_t;
+
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  const clock_t::time_point start_;
+  std::atomic<uint64_t> bytes_per_sec_;
+  std::atomic<uint64_t> bytes_{0};
+  std::atomic<uint64_t> paused_{0}; // in nanoseconds
+  std::mutex mutex_; // for use with next_
+  clock_t::time_point next_; // point in time the budget is paid up to
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // rate_limiter
+
+//////////////////////////////////////////////////////////////////////////////
+/// @class rate_limited_directory
+/// @brief paces writes to outputs created via the directory by a specified
+///        rate_limiter, e.g. to keep merges from saturating disk bandwidth
+//////////////////////////////////////////////////////////////////////////////
+struct IRESEARCH_API rate_limited_directory final : public directory {
+  // @param limiter nullptr == don't pace writes
+  rate_limited_directory(
+    directory& impl,
+    rate_limiter::ptr limiter
+  ) noexcept;
+
+  directory& operator*() noexcept {
+    return impl_;
+  }
+
+  using directory::attributes;
+  virtual attribute_store& attributes() noexcept override {
+    return impl_.attributes();
+  }
+
+  virtual index_output::ptr create(const std::string& name) noexcept override;
+
+  virtual bool exists(
+      bool& result, const std::string& name
+  ) const noexcept override {
+    return impl_.exists(result, name);
+  }
+
+  virtual bool length(
+      uint64_t& result, const std::string& name
+  ) const noexcept override {
+    return impl_.length(result, name);
+  }
+
+  const rate_limiter::ptr& limiter() const noexcept {
+    return limiter_;
+  }
+
+  virtual index_lock::ptr make_lock(
+      const std::string& name
+  ) noexcept override {
+    return impl_.make_lock(name);
+  }
+
+  virtual bool mtime(
+      std::time_t& result, const std::string& name
+  ) const noexcept override {
+    return impl_.mtime(result, name);
+  }
+
+  virtual index_input::ptr open(
+      const std::string& name,
+      IOAdvice advice
+  ) const noexcept override {
+    return impl_.open(name, advice);
+  }
+
+  virtual bool remove(const std::string& name) noexcept override {
+    return impl_.remove(name);
+  }
+
+  virtual bool rename(
+      const std::string& src, const std::string& dst
+  ) noexcept override {
+    return impl_.rename(src, dst);
+  }
+
+  virtual bool sync(const std::string& name) noexcept override {
+    return impl_.sync(name);
+  }
+
+  virtual bool visit(const visitor_f& visitor) const override {
+    return impl_.visit(visitor);
+  }
+
+ private:
+  IRESEARCH_API_PRIVATE_VARIABLES_BEGIN
+  directory& impl_;
+  rate_limiter::ptr limiter_;
+  IRESEARCH_API_PRIVATE_VARIABLES_END
+}; // rate_limited_directory
+
 NS_END
 
 #endif
@@ -464,6 +464,137 @@ index_writer::consolidation_policy_t consolidation_policy(
   };
 }
 
+index_writer::consolidation_policy_t consolidation_policy(
+    const consolidate_cost& options) {
+  // validate input
+  const auto max_segments = (std::max)(size_t(1), options.max_segments); // can't merge less than 1 segment
+  const auto max_segments_bytes = (std::max)(size_t(1), options.max_segments_bytes);
+  const auto floor_segment_bytes = (std::max)(size_t(1), options.floor_segment_bytes);
+  const auto segment_bytes = options.segment_bytes;
+  const auto max_consolidating_bytes = options.max_consolidating_bytes;
+  const auto min_score = options.min_score;
+  const auto on_decision = options.on_decision;
+
+  return [max_segments, max_segments_bytes, floor_segment_bytes, segment_bytes,
+          max_consolidating_bytes, min_score, on_decision](
+      std::set<const segment_meta*>& candidates,
+      const index_meta& meta,
+      const index_writer::consolidating_segments_t& consolidating_segments) -> void {
+    consolidation_decision decision;
+
+    auto decide = [&candidates, &decision, &on_decision](const string_ref& reason) {
+      decision.reason = reason;
+      candidates.insert(decision.segments.begin(), decision.segments.end());
+
+      if (on_decision) {
+        on_decision(decision);
+      }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Stage 0
+    /// get sorted list of segments, evaluate amount of bytes under consolidation
+    ///////////////////////////////////////////////////////////////////////////
+
+    std::set<tier::segment_stat> sorted_segments;
+
+    meta.visit_segments([&](const std::string& /*filename*/, const segment_meta& segment) {
+      if (!segment.live_docs_count) {
+        // skip empty segments, they'll be removed
+        // from index by index_writer during 'commit'
+        return true;
+      }
+
+      if (consolidating_segments.end() != consolidating_segments.find(&segment)) {
+        decision.consolidating_bytes += segment.size;
+      } else {
+        sorted_segments.insert(segment);
+      }
+
+      return true;
+    });
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Stage 1
+    /// throttle consolidations to cap concurrent merge I/O
+    ///////////////////////////////////////////////////////////////////////////
+
+    if (decision.consolidating_bytes >= max_consolidating_bytes) {
+      decide("throttled");
+      return;
+    }
+
+    const size_t budget = (std::min)(
+      max_segments_bytes,
+      max_consolidating_bytes - decision.consolidating_bytes);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Stage 2
+    /// find a range of similarly sized segments with the best benefit/cost
+    ///////////////////////////////////////////////////////////////////////////
+
+    auto best_begin = sorted_segments.end();
+    auto best_end = sorted_segments.end();
+
+    for (auto begin = sorted_segments.begin(), end = sorted_segments.end(); begin != end; ++begin) {
+      size_t count = 0;
+      size_t written = 0;
+      size_t reclaimed = 0;
+
+      for (auto it = begin; it != end && count < max_segments;) {
+        written += it->size;
+
+        if (written > budget) {
+          // overcome the limit
+          break;
+        }
+
+        reclaimed += it->meta->size - it->size;
+        ++it;
+        ++count;
+
+        // every merged segment except one is a segment less to visit by queries
+        const double_t benefit = double_t(reclaimed) + double_t(count - 1)*segment_bytes;
+
+        if (!benefit) {
+          // nothing to gain
+          continue;
+        }
+
+        const double_t cost = double_t((std::max)(written, floor_segment_bytes));
+        const double_t score = benefit / cost;
+
+        if (score < min_score || score <= decision.score) {
+          continue;
+        }
+
+        best_begin = begin;
+        best_end = it;
+        decision.bytes_written = written;
+        decision.bytes_reclaimed = reclaimed;
+        decision.write_amplification = cost / benefit;
+        decision.score = score;
+      }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Stage 3
+    /// pick the best candidate
+    ///////////////////////////////////////////////////////////////////////////
+
+    if (best_begin == best_end) {
+      decide(sorted_segments.empty() ? "nothing to consolidate" : "no candidates");
+      return;
+    }
+
+    for (; best_begin != best_end; ++best_begin) {
+      decision.segments.emplace_back(best_begin->meta);
+    }
+
+    decide(decision.bytes_reclaimed ? "purge removals" : "reduce segment count");
+  };
+}
+
 void read_document_mask(
   iresearch::document_mask& docs_mask,
   const iresearch::directory& dir,
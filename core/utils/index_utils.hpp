@@ -84,6 +84,45 @@ struct consolidate_tier {
   double_t min_score = 0.;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief decision made by a cost-modeled consolidation policy
+////////////////////////////////////////////////////////////////////////////////
+struct consolidation_decision {
+  std::vector<const segment_meta*> segments; // segments to consolidate, empty if none
+  size_t consolidating_bytes{}; // bytes currently under consolidation
+  size_t bytes_written{}; // estimated size of the consolidated segment
+  size_t bytes_reclaimed{}; // estimated size of removed documents to be purged
+  double_t write_amplification{}; // bytes written per byte of benefit
+  double_t score{}; // benefit/cost ratio of the decision
+  string_ref reason; // human readable reason of the decision
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief consolidation policy ranking candidates by their benefit/cost ratio:
+///          cost    - bytes to be rewritten, i.e. live data of the candidates
+///          benefit - bytes of removed documents purged + 'segment_bytes' for
+///                    each segment fewer a query has to visit
+///        thus segments with many removals are preferred, merges of a big
+///        segment with a few small ones are avoided
+/// @param max_segments maximum allowed number of segments to consolidate at once
+/// @param max_segments_bytes maxinum allowed size of all consolidated segments
+/// @param floor_segment_bytes treat all smaller segments as equal for consolidation selection
+/// @param segment_bytes read benefit of removing a segment, expressed in bytes
+/// @param max_consolidating_bytes maximum amount of bytes being consolidated
+///        concurrently, no new consolidation is scheduled while it's exceeded
+/// @param min_score filter out candidates with score less than min_score
+/// @param on_decision optional observer of the decisions made by the policy
+////////////////////////////////////////////////////////////////////////////////
+struct consolidate_cost {
+  size_t max_segments = 10;
+  size_t max_segments_bytes = size_t(5)*(1<<30);
+  size_t floor_segment_bytes = size_t(2)*(1<<20);
+  size_t segment_bytes = size_t(2)*(1<<20);
+  size_t max_consolidating_bytes = integer_traits<size_t>::const_max;
+  double_t min_score = 0.;
+  std::function<void(const consolidation_decision&)> on_decision;
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 /// @return a consolidation policy with the specified options
 ////////////////////////////////////////////////////////////////////////////////
@@ -126,6 +165,13 @@ IRESEARCH_API index_writer::consolidation_policy_t consolidation_policy(
   const consolidate_tier& options
 );
 
+////////////////////////////////////////////////////////////////////////////////
+/// @return a consolidation policy with the specified options
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API index_writer::consolidation_policy_t consolidation_policy(
+  const consolidate_cost& options
+);
+
 void read_document_mask(document_mask& docs_mask, const directory& dir, const segment_meta& meta);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -22,10 +22,13 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "singleton.hpp"
+#include "misc.hpp"
 #include "timer_utils.hpp"
 
+#include <array>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 #include <map>
 
 NS_LOCAL
@@ -97,6 +100,121 @@ class timer_states: public iresearch::singleton<timer_states> {
   bool track_all_keys_;
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief keeps track of per-thread metric shards, values of exited threads
+///        are accumulated in 'retired_'
+////////////////////////////////////////////////////////////////////////////////
+class metric_registry: public iresearch::singleton<metric_registry> {
+ public:
+  typedef iresearch::timer_utils::metric_shard shard_t;
+  typedef std::array<uint64_t, shard_t::SIZE> values_t;
+
+  struct totals_t {
+    values_t counts{};
+    values_t times{};
+  };
+
+  void attach(shard_t& shard) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shards_.insert(&shard);
+  }
+
+  void detach(shard_t& shard) noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    accumulate(retired_, shard);
+    shards_.erase(&shard);
+  }
+
+  // shared by threads which failed to register their own shards,
+  // concurrent updates of such threads may get lost
+  shard_t& fallback() noexcept {
+    return fallback_;
+  }
+
+  totals_t totals() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto totals = totals_locked();
+
+    for (size_t i = 0; i < shard_t::SIZE; ++i) {
+      totals.counts[i] -= baseline_.counts[i];
+      totals.times[i] -= baseline_.times[i];
+    }
+
+    return totals;
+  }
+
+  void reset() {
+    // shards are modified by their owners only, so reset
+    // just remembers current values as a new baseline
+    std::lock_guard<std::mutex> lock(mutex_);
+    baseline_ = totals_locked();
+  }
+
+ private:
+  static void accumulate(totals_t& totals, const shard_t& shard) noexcept {
+    for (size_t i = 0; i < shard_t::SIZE; ++i) {
+      totals.counts[i] += shard.counts[i].load(std::memory_order_relaxed);
+      totals.times[i] += shard.times[i].load(std::memory_order_relaxed);
+    }
+  }
+
+  totals_t totals_locked() const noexcept {
+    auto totals = retired_;
+    accumulate(totals, fallback_);
+
+    for (auto* shard : shards_) {
+      accumulate(totals, *shard);
+    }
+
+    return totals;
+  }
+
+  std::mutex mutex_;
+  std::unordered_set<shard_t*> shards_;
+  totals_t retired_;
+  totals_t baseline_;
+  shard_t fallback_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief thread local shard registered within 'metric_registry'
+////////////////////////////////////////////////////////////////////////////////
+class local_metric_shard {
+ public:
+  local_metric_shard()
+    : registry_(&metric_registry::instance()) {
+    registry_->attach(shard_);
+  }
+
+  ~local_metric_shard() {
+    registry_->detach(shard_);
+
+    // thread local destructors may still update metrics
+    iresearch::timer_utils::local_metrics_shard = &registry_->fallback();
+  }
+
+  iresearch::timer_utils::metric_shard& shard() noexcept {
+    return shard_;
+  }
+
+ private:
+  metric_registry* registry_;
+  iresearch::timer_utils::metric_shard shard_;
+};
+
+const iresearch::string_ref METRIC_NAMES[] {
+  "postings_block_decode",
+  "column_block_load",
+  "term_seek",
+  "segment_flush",
+  "segment_merge"
+};
+
+static_assert(
+  IRESEARCH_COUNTOF(METRIC_NAMES) == size_t(iresearch::timer_utils::metric::COUNT),
+  "invalid metric names"
+);
+
 NS_END // NS_LOCAL
 
 NS_ROOT
@@ -176,5 +294,62 @@ void flush_stats(std::ostream &out) {
   }
 }
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   runtime metrics
+// -----------------------------------------------------------------------------
+
+string_ref metric_name(metric id) noexcept {
+  return size_t(id) < IRESEARCH_COUNTOF(METRIC_NAMES)
+    ? METRIC_NAMES[size_t(id)]
+    : string_ref::NIL;
+}
+
+metric_shard& register_local_metrics() noexcept {
+  metric_shard* shard;
+
+  try {
+    static thread_local local_metric_shard local;
+    shard = &local.shard();
+  } catch (...) {
+    // failed to register a shard, e.g. out of memory
+    shard = &metric_registry::instance().fallback();
+  }
+
+  local_metrics_shard = shard;
+
+  return *shard;
+}
+
+bool visit_metrics(
+    const std::function<bool(metric id, uint64_t count, uint64_t time_ns)>& visitor
+) {
+  const auto totals = metric_registry::instance().totals();
+
+  for (size_t i = 0; i < metric_shard::SIZE; ++i) {
+    if (!visitor(metric(i), totals.counts[i], totals.times[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void reset_metrics() {
+  metric_registry::instance().reset();
+}
+
+void flush_metrics(std::ostream& out) {
+  visit_metrics([&out](metric id, uint64_t count, uint64_t time_ns)->bool {
+    out << metric_name(id) << "\tcount:" << count;
+
+    if (time_ns) {
+      out << ",\ttime: " << time_ns/1000 << " us,\tavg: " << time_ns/1000/double(count) << " us";
+    }
+
+    out << std::endl;
+    return true;
+  });
+}
+
 NS_END // timer_utils
 NS_END // NS_ROOT
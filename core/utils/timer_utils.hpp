@@ -25,6 +25,7 @@
 #define IRESEARCH_TIMER_UTILS_H
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <unordered_set>
 #include "utils/noncopyable.hpp"
@@ -108,6 +109,124 @@ IRESEARCH_API bool visit(
 ////////////////////////////////////////////////////////////////////////////////
 IRESEARCH_API void flush_stats(std::ostream &out);
 
+// -----------------------------------------------------------------------------
+// --SECTION--                                                   runtime metrics
+// -----------------------------------------------------------------------------
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief always-on metrics known at compile time, each metric tracks the
+///        number of events and the total time spent in timed events
+////////////////////////////////////////////////////////////////////////////////
+enum class metric : size_t {
+  POSTINGS_BLOCK_DECODE = 0, // postings blocks decoded
+  COLUMN_BLOCK_LOAD, // columnstore blocks loaded
+  TERM_SEEK, // term dictionary seeks
+  SEGMENT_FLUSH, // segments flushed by index_writer
+  SEGMENT_MERGE, // segments produced by merge_writer
+  COUNT // number of metrics, must be the last one
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns human readable name of the specified metric
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API string_ref metric_name(metric id) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief per-thread storage of metric values, values are modified only by
+///        the owning thread, hence no atomic read-modify-write on a hot path,
+///        readers aggregate values of all shards
+////////////////////////////////////////////////////////////////////////////////
+struct metric_shard : private util::noncopyable {
+  static constexpr size_t SIZE = size_t(metric::COUNT);
+
+  metric_shard() = default;
+
+  void add(metric id, uint64_t count, uint64_t time_ns) noexcept {
+    auto& cnt = counts[size_t(id)];
+    cnt.store(cnt.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+
+    if (time_ns) {
+      auto& tm = times[size_t(id)];
+      tm.store(tm.load(std::memory_order_relaxed) + time_ns, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<uint64_t> counts[SIZE]{};
+  std::atomic<uint64_t> times[SIZE]{}; // nanoseconds
+}; // metric_shard
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief registers a shard for the current thread, on failure a shard shared
+///        by all such threads is used instead
+/// @returns shard of the current thread
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API metric_shard& register_local_metrics() noexcept;
+
+// shard of the current thread, nullptr until the first metric update
+inline thread_local metric_shard* local_metrics_shard = nullptr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @returns shard of the current thread
+////////////////////////////////////////////////////////////////////////////////
+inline metric_shard& local_metrics() noexcept {
+  auto* shard = local_metrics_shard;
+
+  if (IRS_UNLIKELY(!shard)) {
+    shard = &register_local_metrics();
+  }
+
+  return *shard;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief accounts 'value' events of the specified metric
+////////////////////////////////////////////////////////////////////////////////
+inline void count(metric id, uint64_t value = 1) noexcept {
+  local_metrics().add(id, value, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class scoped_metric
+/// @brief accounts a single event of the specified metric along with the
+///        time spent within a scope
+////////////////////////////////////////////////////////////////////////////////
+class scoped_metric : private util::noncopyable {
+ public:
+  typedef std::chrono::steady_clock clock_t;
+
+  explicit scoped_metric(metric id) noexcept
+    : start_(clock_t::now()), id_(id) {
+  }
+
+  ~scoped_metric() {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      clock_t::now() - start_);
+    local_metrics().add(id_, 1, uint64_t(elapsed.count()));
+  }
+
+ private:
+  clock_t::time_point start_;
+  metric id_;
+}; // scoped_metric
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief visit aggregated values of all metrics, may be called concurrently
+///        with metric updates, values of the running threads may lag behind
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API bool visit_metrics(
+  const std::function<bool(metric id, uint64_t count, uint64_t time_ns)>& visitor
+);
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief resets aggregated values of all metrics to zero
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API void reset_metrics();
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief flush formatted metrics to a specified stream
+////////////////////////////////////////////////////////////////////////////////
+IRESEARCH_API void flush_metrics(std::ostream& out);
+
 NS_END // timer_utils
 NS_END // NS_ROOT
 
@@ -176,3 +176,40 @@ TEST_F(analyzer_test, test_load) {
   ASSERT_EQ(nullptr, irs::analysis::analyzers::get("text", irs::type<irs::text_format::json>::get(), "{{\"locale\":\"en\", \"stopwords\":\"abc\"}}"));
   ASSERT_EQ(nullptr, irs::analysis::analyzers::get("text", irs::type<irs::text_format::json>::get(), "{{\"locale\":\"en\", \"stopwords\":[1, 2, 3]}}"));
 }
+
+TEST_F(analyzer_test, get_pooled) {
+  const auto json = irs::type<irs::text_format::json>::get();
+
+  const irs::analysis::analyzer* instance = nullptr;
+
+  {
+    auto analyzer = irs::analysis::analyzers::get_pooled("text", json, "{\"locale\":\"en\"}");
+    ASSERT_NE(nullptr, analyzer);
+    ASSERT_TRUE(analyzer->reset("abc"));
+    instance = analyzer.get();
+
+    // instance in use isn't shared
+    auto other = irs::analysis::analyzers::get_pooled("text", json, "{\"locale\":\"en\"}");
+    ASSERT_NE(nullptr, other);
+    ASSERT_NE(instance, other.get());
+  }
+
+  // instance is reused for equivalent arguments
+  {
+    auto analyzer = irs::analysis::analyzers::get_pooled("text", json, "{ \"locale\" : \"en\" }");
+    ASSERT_NE(nullptr, analyzer);
+    ASSERT_EQ(instance, analyzer.get());
+    ASSERT_TRUE(analyzer->reset("abc"));
+
+    // different arguments
+    auto other = irs::analysis::analyzers::get_pooled("text", json, "{\"locale\":\"en\", \"stopwords\":[\"abc\"]}");
+    ASSERT_NE(nullptr, other);
+    ASSERT_NE(instance, other.get());
+  }
+
+  // unknown analyzer
+  ASSERT_EQ(nullptr, irs::analysis::analyzers::get_pooled("unknown_analyzer", json, "{}"));
+
+  // invalid arguments
+  ASSERT_EQ(nullptr, irs::analysis::analyzers::get_pooled("text", json, "{}"));
+}
@@ -21,10 +21,12 @@
 /// @author Vasiliy Nabatchikov
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <fstream>
 #include <sstream>
 #include "tests_shared.hpp"
 #include "analysis/ngram_token_stream.hpp"
 #include "utils/locale_utils.hpp"
+#include "utils/timer_utils.hpp"
 #include <utf8.h>
 
 #ifndef IRESEARCH_DLL
@@ -1303,6 +1305,64 @@ TEST(ngram_token_stream_test, test_out_of_range_pos_issue) {
 //  ASSERT_FALSE(stream.next());
 //}
 
+class ngram_token_stream_profile_test : public test_base { };
+
+TEST_F(ngram_token_stream_profile_test, profile_utf8) {
+  constexpr size_t MIN_GRAM = 2;
+  constexpr size_t MAX_GRAM = 5;
+  constexpr size_t SYMBOLS = 256; // symbols per input
+  constexpr size_t ITERATIONS = 4096;
+
+  // number of ngrams in [MIN_GRAM;MAX_GRAM] of an input of SYMBOLS symbols
+  size_t expected_count = 0;
+  for (auto gram = MIN_GRAM; gram <= MAX_GRAM; ++gram) {
+    expected_count += SYMBOLS - gram + 1;
+  }
+
+  irs::analysis::ngram_token_stream<irs::analysis::ngram_token_stream_base::InputType::UTF8> stream(
+    irs::analysis::ngram_token_stream_base::Options(
+      MIN_GRAM, MAX_GRAM, false,
+      irs::analysis::ngram_token_stream_base::InputType::UTF8,
+      irs::bytes_ref::EMPTY, irs::bytes_ref::EMPTY));
+  auto* term = irs::get<irs::term_attribute>(stream);
+  ASSERT_NE(nullptr, term);
+
+  auto profile = [&](const std::string& data, size_t symbol_size, const char* name) {
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+      SCOPED_TIMER(name);
+      ASSERT_TRUE(stream.reset(data));
+
+      size_t count = 0;
+      for (; stream.next(); ++count) {
+        ASSERT_EQ(0, term->value.size() % symbol_size);
+        ASSERT_LE(MIN_GRAM, term->value.size() / symbol_size);
+        ASSERT_GE(MAX_GRAM, term->value.size() / symbol_size);
+      }
+      ASSERT_EQ(expected_count, count);
+    }
+  };
+
+  std::string ascii;
+  std::string cjk;
+  for (size_t i = 0; i < SYMBOLS; ++i) {
+    ascii += char('a' + i % 26);
+    cjk += "\xe4\xb8\xad"; // U+4E2D
+  }
+
+  irs::timer_utils::init_stats(true);
+
+  profile(ascii, 1, "ngram utf8 ascii input");
+  profile(cjk, 3, "ngram utf8 cjk input");
+
+  auto path = test_dir();
+  path /= "profile_ngram_token_stream.log";
+
+  std::ofstream out(path.native());
+  irs::timer_utils::flush_stats(out);
+  out.close();
+  std::cout << "Path to timing log: " << path.utf8_absolute() << std::endl;
+}
+
 #endif // IRESEARCH_DLL
 
 TEST(ngram_token_stream_test, test_load) {
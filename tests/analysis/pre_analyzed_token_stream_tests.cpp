@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "analysis/delimited_token_stream.hpp"
+#include "analysis/pre_analyzed_token_stream.hpp"
+#include "analysis/token_streams.hpp"
+
+TEST(pre_analyzed_token_stream_test, write_read) {
+  constexpr irs::string_ref data = "quick,brown,,\"fox\",jumps";
+  irs::analysis::delimited_token_stream expected(",");
+  irs::analysis::delimited_token_stream source(",");
+  auto* expected_inc = irs::get<irs::increment>(expected);
+  auto* expected_offs = irs::get<irs::offset>(expected);
+  auto* expected_pay = irs::get<irs::payload>(expected);
+  auto* expected_term = irs::get<irs::term_attribute>(expected);
+
+  irs::pre_analyzed_token_stream stream;
+  auto* inc = irs::get<irs::increment>(stream);
+  auto* offs = irs::get<irs::offset>(stream);
+  auto* pay = irs::get<irs::payload>(stream);
+  auto* term = irs::get<irs::term_attribute>(stream);
+  ASSERT_NE(nullptr, inc);
+  ASSERT_NE(nullptr, offs);
+  ASSERT_NE(nullptr, pay);
+  ASSERT_NE(nullptr, term);
+
+  // all features
+  {
+    irs::bstring buf;
+    ASSERT_TRUE(source.reset(data));
+    ASSERT_TRUE(irs::pre_analyzed_token_stream::write(
+      source,
+      irs::pre_analyzed_token_stream::OFFSETS | irs::pre_analyzed_token_stream::PAYLOADS,
+      buf));
+
+    ASSERT_TRUE(stream.reset(buf));
+    ASSERT_EQ(irs::pre_analyzed_token_stream::OFFSETS | irs::pre_analyzed_token_stream::PAYLOADS,
+              stream.features());
+    ASSERT_TRUE(expected.reset(data));
+
+    while (expected.next()) {
+      ASSERT_TRUE(stream.next());
+      ASSERT_EQ(expected_term->value, term->value);
+      ASSERT_EQ(expected_inc->value, inc->value);
+      ASSERT_EQ(expected_offs->start, offs->start);
+      ASSERT_EQ(expected_offs->end, offs->end);
+      ASSERT_EQ(expected_pay->value, pay->value);
+
+      // values reference the input buffer
+      ASSERT_TRUE(term->value.empty() || (term->value.begin() >= buf.data()
+                  && term->value.end() <= buf.data() + buf.size()));
+    }
+
+    ASSERT_FALSE(stream.next());
+    ASSERT_TRUE(stream.eof());
+  }
+
+  // terms and increments only
+  {
+    irs::bstring buf;
+    ASSERT_TRUE(source.reset(data));
+    ASSERT_TRUE(irs::pre_analyzed_token_stream::write(
+      source, irs::pre_analyzed_token_stream::NONE, buf));
+
+    ASSERT_TRUE(stream.reset(buf));
+    ASSERT_EQ(irs::pre_analyzed_token_stream::NONE, stream.features());
+    ASSERT_TRUE(expected.reset(data));
+
+    while (expected.next()) {
+      ASSERT_TRUE(stream.next());
+      ASSERT_EQ(expected_term->value, term->value);
+      ASSERT_EQ(expected_inc->value, inc->value);
+      ASSERT_EQ(0, offs->start);
+      ASSERT_EQ(0, offs->end);
+      ASSERT_TRUE(pay->value.null());
+    }
+
+    ASSERT_FALSE(stream.next());
+    ASSERT_TRUE(stream.eof());
+  }
+
+  // stream without offsets and payloads
+  {
+    irs::string_token_stream string_stream;
+    string_stream.reset("value");
+
+    irs::bstring buf;
+    ASSERT_TRUE(irs::pre_analyzed_token_stream::write(
+      string_stream, irs::pre_analyzed_token_stream::PAYLOADS, buf));
+
+    ASSERT_TRUE(stream.reset(buf));
+    ASSERT_TRUE(stream.next());
+    ASSERT_EQ(irs::ref_cast<irs::byte_type>(irs::string_ref("value")), term->value);
+    ASSERT_EQ(1, inc->value);
+    ASSERT_TRUE(pay->value.empty());
+    ASSERT_FALSE(stream.next());
+    ASSERT_TRUE(stream.eof());
+  }
+}
+
+TEST(pre_analyzed_token_stream_test, malformed) {
+  irs::pre_analyzed_token_stream stream;
+
+  // invalid header
+  ASSERT_FALSE(stream.reset(irs::bytes_ref::NIL));
+  ASSERT_FALSE(stream.next());
+  ASSERT_FALSE(stream.reset(irs::string_ref("\x00", 1)));
+  ASSERT_FALSE(stream.reset(irs::string_ref("\x01\x00", 2))); // unknown version
+  ASSERT_FALSE(stream.reset(irs::string_ref("\x00\x04", 2))); // unknown features
+
+  // no tokens
+  ASSERT_TRUE(stream.reset(irs::string_ref("\x00\x00", 2)));
+  ASSERT_TRUE(stream.eof());
+  ASSERT_FALSE(stream.next());
+
+  // truncated data
+  irs::bstring buf;
+  {
+    irs::analysis::delimited_token_stream source(",");
+    ASSERT_TRUE(source.reset("a,bc,def"));
+    ASSERT_TRUE(irs::pre_analyzed_token_stream::write(
+      source, irs::pre_analyzed_token_stream::OFFSETS | irs::pre_analyzed_token_stream::PAYLOADS,
+      buf));
+  }
+
+  for (size_t size = 3; size < buf.size(); ++size) {
+    ASSERT_TRUE(stream.reset(irs::bytes_ref(buf.c_str(), size)));
+    size_t count = 0;
+    while (stream.next()) { ++count; }
+    ASSERT_GT(3, count);
+  }
+
+  ASSERT_TRUE(stream.reset(buf));
+  size_t count = 0;
+  while (stream.next()) { ++count; }
+  ASSERT_EQ(3, count);
+  ASSERT_TRUE(stream.eof());
+
+  // decreasing start offsets can't be written
+  {
+    struct decreasing_token_stream final : irs::frozen_attributes<3, irs::token_stream> {
+      decreasing_token_stream() noexcept
+        : attributes{{
+            { irs::type<irs::increment>::id(),      &inc },
+            { irs::type<irs::offset>::id(),         &offs },
+            { irs::type<irs::term_attribute>::id(), &term }
+          }} {
+      }
+
+      virtual bool next() noexcept override {
+        if (!count) {
+          return false;
+        }
+
+        offs.start = --count;
+        offs.end = offs.start + 1;
+        return true;
+      }
+
+      irs::increment inc;
+      irs::offset offs;
+      irs::term_attribute term;
+      size_t count{2};
+    } source;
+
+    irs::bstring buf;
+    ASSERT_FALSE(irs::pre_analyzed_token_stream::write(
+      source, irs::pre_analyzed_token_stream::OFFSETS, buf));
+  }
+}
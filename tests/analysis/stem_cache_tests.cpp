@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "analysis/stem_cache.hpp"
+
+NS_LOCAL
+
+irs::bytes_ref as_bytes(const irs::string_ref& value) {
+  return irs::ref_cast<irs::byte_type>(value);
+}
+
+NS_END
+
+TEST(stem_cache_test, find_emplace) {
+  irs::analysis::stem_cache cache;
+  ASSERT_EQ(irs::analysis::stem_cache::DEFAULT_CAPACITY, cache.capacity());
+  ASSERT_EQ(0, cache.size());
+
+  irs::bytes_ref stem;
+  ASSERT_FALSE(cache.find(as_bytes("running"), stem));
+  ASSERT_EQ(0, cache.hits());
+  ASSERT_EQ(1, cache.misses());
+
+  cache.emplace(as_bytes("running"), as_bytes("run"));
+  cache.emplace(as_bytes("runs"), as_bytes("run"));
+  cache.emplace(as_bytes("cats"), as_bytes("cat"));
+  cache.emplace(as_bytes("cats"), as_bytes("cat")); // already cached
+  ASSERT_EQ(3, cache.size());
+
+  ASSERT_TRUE(cache.find(as_bytes("running"), stem));
+  ASSERT_EQ(as_bytes("run"), stem);
+  ASSERT_TRUE(cache.find(as_bytes("runs"), stem));
+  ASSERT_EQ(as_bytes("run"), stem);
+  ASSERT_TRUE(cache.find(as_bytes("cats"), stem));
+  ASSERT_EQ(as_bytes("cat"), stem);
+  ASSERT_FALSE(cache.find(as_bytes("cat"), stem));
+  ASSERT_FALSE(cache.find(as_bytes("run"), stem));
+  ASSERT_EQ(3, cache.hits());
+  ASSERT_EQ(3, cache.misses());
+
+  // empty stem
+  cache.emplace(as_bytes("a"), irs::bytes_ref::EMPTY);
+  ASSERT_TRUE(cache.find(as_bytes("a"), stem));
+  ASSERT_TRUE(stem.empty());
+
+  // empty and long words aren't cached
+  const std::string long_word(irs::analysis::stem_cache::MAX_SIZE + 1, 'a');
+  cache.emplace(as_bytes(long_word), as_bytes("a"));
+  cache.emplace(irs::bytes_ref::EMPTY, as_bytes("a"));
+  ASSERT_EQ(4, cache.size());
+  ASSERT_FALSE(cache.find(as_bytes(long_word), stem));
+  ASSERT_FALSE(cache.find(irs::bytes_ref::EMPTY, stem));
+
+  cache.clear();
+  ASSERT_EQ(0, cache.size());
+  ASSERT_FALSE(cache.find(as_bytes("running"), stem));
+  ASSERT_EQ(4, cache.hits()); // counters are kept
+}
+
+TEST(stem_cache_test, overflow) {
+  irs::analysis::stem_cache cache(16);
+  ASSERT_EQ(16, cache.capacity());
+
+  for (size_t i = 0; i < 1000; ++i) {
+    const auto word = "word" + std::to_string(i);
+    const auto stem = "stem" + std::to_string(i);
+    cache.emplace(as_bytes(word), as_bytes(stem));
+    ASSERT_LE(cache.size(), cache.capacity());
+
+    irs::bytes_ref value;
+    ASSERT_TRUE(cache.find(as_bytes(word), value));
+    ASSERT_EQ(as_bytes(stem), value);
+  }
+
+  // the most recent words are still cached
+  irs::bytes_ref value;
+  ASSERT_TRUE(cache.find(as_bytes("word999"), value));
+  ASSERT_EQ(as_bytes("stem999"), value);
+  ASSERT_FALSE(cache.find(as_bytes("word0"), value));
+}
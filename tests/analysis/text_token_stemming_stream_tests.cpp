@@ -85,6 +85,15 @@ TEST_F(text_token_stemming_stream_tests, test_stemming) {
     ASSERT_EQ("running", irs::ref_cast<char>(payload->value));
     ASSERT_EQ("run", irs::ref_cast<char>(term->value));
     ASSERT_FALSE(stream.next());
+
+    // stems of repeated words come from the cache
+    for (irs::string_ref word : { "cats", "running", "cats", "running" }) {
+      ASSERT_TRUE(stream.reset(word));
+      ASSERT_TRUE(stream.next());
+      ASSERT_EQ(word, irs::ref_cast<char>(payload->value));
+      ASSERT_EQ(word == "cats" ? "cat" : "run", irs::ref_cast<char>(term->value));
+      ASSERT_FALSE(stream.next());
+    }
   }
 
   // test stemming (stemmer does not exist)
@@ -291,6 +291,49 @@ class format_10_test_case : public tests::format_test_case {
           }
         }
 
+        // seek into the middle, to the end and past the end of every block
+        {
+          const size_t block_size = VERSION10_POSTINGS_WRITER_BLOCK_SIZE;
+          auto it = reader->iterator(field.features, read_attrs, field.features);
+          ASSERT_FALSE(irs::doc_limits::valid(it->value()));
+
+          postings expected(docs.begin(), docs.end(), field.features);
+          for (size_t i = 0, size = docs.size(); i < size; i += block_size) {
+            const size_t middle = std::min(i + block_size/2, size - 1);
+            const size_t last = std::min(i + block_size - 1, size - 1);
+
+            for (const auto target : { docs[middle], docs[last], docs[last] + 1 }) {
+              const auto doc = expected.seek(target);
+              ASSERT_EQ(doc, it->seek(target));
+
+              if (irs::doc_limits::eof(doc)) {
+                break;
+              }
+
+              assert_positions(expected, *it);
+            }
+          }
+        }
+
+        // seek to the documents absent in the list, i.e. in between the
+        // existing ones, whole block may be located below the target
+        {
+          auto it = reader->iterator(field.features, read_attrs, field.features);
+          ASSERT_FALSE(irs::doc_limits::valid(it->value()));
+
+          postings expected(docs.begin(), docs.end(), field.features);
+          for (size_t i = 1, size = docs.size(); i < size; i += 7) {
+            if (docs[i-1] + 1 == docs[i]) {
+              continue; // no gap
+            }
+
+            const auto target = docs[i] - 1;
+            ASSERT_EQ(docs[i], expected.seek(target));
+            ASSERT_EQ(docs[i], it->seek(target));
+            assert_positions(expected, *it);
+          }
+        }
+
         // seek for INVALID_DOC
         {
           auto it = reader->iterator(field.features, read_attrs, irs::flags::empty_instance());
@@ -916,6 +959,24 @@ TEST_P(format_10_test_case, postings_seek) {
     postings_seek(docs, { irs::type<irs::frequency>::get(), irs::type<irs::position>::get(), irs::type<irs::payload>::get() });
     postings_seek(docs, { irs::type<irs::frequency>::get(), irs::type<irs::position>::get(), irs::type<irs::offset>::get(), irs::type<irs::payload>::get() });
   }
+
+  // dense and sparse regions, seeks land inside, at the end and past blocks
+  {
+    std::vector<irs::doc_id_t> docs;
+    {
+      const size_t count = 5000;
+      docs.reserve(count);
+      auto i = (irs::doc_limits::min)();
+      for (size_t k = 0; k < count; ++k) {
+        docs.push_back(i);
+        i += (k % 300 < 150) ? 1 : 50;
+      }
+    }
+    postings_seek(docs, {});
+    postings_seek(docs, { irs::type<irs::frequency>::get() });
+    postings_seek(docs, { irs::type<irs::frequency>::get(), irs::type<irs::position>::get() });
+    postings_seek(docs, { irs::type<irs::frequency>::get(), irs::type<irs::position>::get(), irs::type<irs::offset>::get(), irs::type<irs::payload>::get() });
+  }
 }
 
 // -----------------------------------------------------------------------------
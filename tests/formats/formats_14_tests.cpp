@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "formats_test_case_base.hpp"
+#include "formats/format_utils.hpp"
+#include "store/directory_attributes.hpp"
+
+#include <condition_variable>
+#include <map>
+#include <thread>
+
+NS_LOCAL
+
+typedef std::map<std::string, std::vector<irs::bstring>> field_terms_t;
+
+// reads terms of all fields of the specified segment
+field_terms_t read_terms(const irs::sub_reader& segment) {
+  field_terms_t terms;
+
+  for (auto fields = segment.fields(); fields->next(); ) {
+    auto& field = fields->value();
+    auto& field_terms = terms[field.meta().name];
+
+    for (auto it = field.iterator(); it->next(); ) {
+      field_terms.emplace_back(it->value());
+    }
+  }
+
+  return terms;
+}
+
+// writes the first 'count' documents of 'simple_sequential.json'
+// as a single segment
+void write_segment(
+    irs::directory& dir,
+    const irs::format::ptr& codec,
+    irs::OpenMode mode,
+    tests::json_doc_generator& gen,
+    size_t count) {
+  auto writer = irs::index_writer::make(dir, codec, mode);
+  ASSERT_NE(nullptr, writer);
+
+  for (const tests::document* doc; count && (doc = gen.next()); --count) {
+    ASSERT_TRUE(insert(*writer,
+      doc->indexed.begin(), doc->indexed.end(),
+      doc->stored.begin(), doc->stored.end()));
+  }
+
+  writer->commit();
+}
+
+// @returns version of the term index written to the specified directory
+int32_t term_index_version(irs::directory& dir) {
+  std::string filename;
+  dir.visit([&filename](std::string& name) {
+    if (name.size() > 3 && 0 == name.compare(name.size() - 3, 3, ".ti")) {
+      filename = name;
+      return false;
+    }
+    return true;
+  });
+  EXPECT_FALSE(filename.empty());
+
+  auto in = dir.open(filename, irs::IOAdvice::NORMAL);
+  EXPECT_NE(nullptr, in);
+
+  return irs::format_utils::check_header(
+    *in, "block_tree_terms_index", 0, std::numeric_limits<int32_t>::max());
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                          format 14 specific tests
+// -----------------------------------------------------------------------------
+
+class format_14_test_case : public tests::directory_test_case_base {
+ protected:
+  // terms of the documents written to 'dir()', read by the format
+  // loading all term indices at segment open
+  field_terms_t expected_terms(size_t offset, size_t count) {
+    irs::memory_directory dir;
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+
+    for (; offset; --offset) {
+      gen.next();
+    }
+
+    write_segment(dir, irs::formats::get("1_3", "1_0"), irs::OM_CREATE, gen, count);
+    auto reader = irs::directory_reader::open(dir);
+    EXPECT_EQ(1, reader.size());
+    EXPECT_EQ(1, term_index_version(dir));
+
+    return read_terms(reader[0]);
+  }
+};
+
+TEST_P(format_14_test_case, write_term_index_offsets) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  write_segment(dir(), irs::formats::get("1_4", "1_0"), irs::OM_CREATE, gen, 10);
+  ASSERT_EQ(2, term_index_version(dir()));
+
+  auto reader = irs::directory_reader::open(dir());
+  ASSERT_EQ(1, reader.size());
+  ASSERT_EQ(expected_terms(0, 10), read_terms(reader[0]));
+}
+
+TEST_P(format_14_test_case, concurrent_first_access) {
+  constexpr size_t THREADS = 8;
+
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  write_segment(dir(), irs::formats::get("1_4", "1_0"), irs::OM_CREATE, gen, 32);
+
+  const auto expected = expected_terms(0, 32);
+  ASSERT_LT(1, expected.size());
+
+  auto reader = irs::directory_reader::open(dir());
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0];
+
+  std::mutex mutex;
+  std::condition_variable ready_cv;
+  bool ready = false;
+  std::vector<field_terms_t> actual(THREADS);
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < THREADS; ++i) {
+    threads.emplace_back([&, i]() {
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        ready_cv.wait(lock, [&ready](){ return ready; });
+      }
+
+      // none of the term indices is loaded yet
+      actual[i] = read_terms(segment);
+    });
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    ready = true;
+  }
+  ready_cv.notify_all();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto& terms : actual) {
+    ASSERT_EQ(expected, terms);
+  }
+}
+
+TEST_P(format_14_test_case, reopen) {
+  auto codec = irs::formats::get("1_4", "1_0");
+  ASSERT_NE(nullptr, codec);
+
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  write_segment(dir(), codec, irs::OM_CREATE, gen, 5);
+
+  auto reader = irs::directory_reader::open(dir(), codec);
+  ASSERT_EQ(1, reader.size());
+
+  // access a single field only
+  {
+    auto* field = reader[0].field("name");
+    ASSERT_NE(nullptr, field);
+    auto it = field->iterator();
+    ASSERT_TRUE(it->next());
+  }
+
+  write_segment(dir(), codec, irs::OM_APPEND, gen, 7);
+
+  auto new_reader = reader.reopen(codec);
+  ASSERT_NE(reader, new_reader);
+  ASSERT_EQ(2, new_reader.size());
+
+  // segment with partially loaded term indices is reused
+  ASSERT_EQ(&reader[0], &new_reader[0]);
+  ASSERT_EQ(expected_terms(0, 5), read_terms(new_reader[0]));
+  ASSERT_EQ(expected_terms(5, 7), read_terms(new_reader[1]));
+
+  // the original reader remains valid
+  ASSERT_EQ(expected_terms(0, 5), read_terms(reader[0]));
+}
+
+TEST_P(format_14_test_case, open_13_with_14) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  // write segment with format13, term index of version 1
+  write_segment(dir(), irs::formats::get("1_3", "1_0"), irs::OM_CREATE, gen, 10);
+  ASSERT_EQ(1, term_index_version(dir()));
+
+  // check index, term indices are loaded at open
+  auto codec = irs::formats::get("1_4", "1_0");
+  ASSERT_NE(nullptr, codec);
+  auto reader = irs::directory_reader::open(dir(), codec);
+  ASSERT_EQ(1, reader.size());
+  ASSERT_EQ(expected_terms(0, 10), read_terms(reader[0]));
+}
+
+TEST_P(format_14_test_case, formats_13_14) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  write_segment(dir(), irs::formats::get("1_3", "1_0"), irs::OM_CREATE, gen, 10);
+  write_segment(dir(), irs::formats::get("1_4", "1_0"), irs::OM_APPEND, gen, 10);
+
+  auto reader = irs::directory_reader::open(dir());
+  ASSERT_EQ(2, reader.size());
+  ASSERT_EQ(expected_terms(0, 10), read_terms(reader[0]));
+  ASSERT_EQ(expected_terms(10, 10), read_terms(reader[1]));
+}
+
+INSTANTIATE_TEST_CASE_P(
+  format_14_test,
+  format_14_test_case,
+  ::testing::Values(
+    &tests::memory_directory,
+    &tests::mmap_directory,
+    &tests::rot13_cipher_directory<&tests::memory_directory, 16>,
+    &tests::rot13_cipher_directory<&tests::fs_directory, 16>,
+    &tests::rot13_cipher_directory<&tests::mmap_directory, 16>,
+    &tests::rot13_cipher_directory<&tests::memory_directory, 7>,
+    &tests::rot13_cipher_directory<&tests::mmap_directory, 7>
+  ),
+  tests::directory_test_case_base::to_string
+);
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                     generic tests
+// -----------------------------------------------------------------------------
+
+using tests::format_test_case;
+
+INSTANTIATE_TEST_CASE_P(
+  format_14_test,
+  format_test_case,
+  ::testing::Combine(
+    ::testing::Values(
+      &tests::rot13_cipher_directory<&tests::memory_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::fs_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::mmap_directory, 16>,
+      &tests::rot13_cipher_directory<&tests::memory_directory, 7>,
+      &tests::rot13_cipher_directory<&tests::fs_directory, 7>,
+      &tests::rot13_cipher_directory<&tests::mmap_directory, 7>
+    ),
+    ::testing::Values(tests::format_info{"1_4", "1_0"})
+  ),
+  tests::to_string
+);
+
+NS_END
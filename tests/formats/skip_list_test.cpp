@@ -1212,3 +1212,91 @@ TEST_F(skip_reader_test, seek) {
     }
   }
 }
+
+TEST_F(skip_reader_test, seek_cached_levels) {
+  // counts number of streams duplicated for reading skip levels
+  class counting_input final : public irs::index_input {
+   public:
+    counting_input(irs::index_input::ptr&& in, size_t& dups) noexcept
+      : in_(std::move(in)), dups_(&dups) {
+    }
+    virtual ptr dup() const override {
+      ++*dups_;
+      return ptr(new counting_input(in_->dup(), *dups_));
+    }
+    virtual ptr reopen() const override {
+      return ptr(new counting_input(in_->reopen(), *dups_));
+    }
+    virtual void seek(size_t pos) override { in_->seek(pos); }
+    virtual int64_t checksum(size_t offset) const override { return in_->checksum(offset); }
+    virtual irs::byte_type read_byte() override { return in_->read_byte(); }
+    virtual size_t read_bytes(irs::byte_type* b, size_t count) override { return in_->read_bytes(b, count); }
+    virtual const irs::byte_type* read_buffer(size_t count, irs::BufferHint hint) override { return in_->read_buffer(count, hint); }
+    virtual size_t file_pointer() const override { return in_->file_pointer(); }
+    virtual size_t length() const override { return in_->length(); }
+    virtual bool eof() const override { return in_->eof(); }
+
+   private:
+    irs::index_input::ptr in_;
+    size_t* dups_;
+  };
+
+  const size_t count = 1932;
+  const size_t max_levels = 5;
+  const size_t skip = 8;
+
+  irs::memory_directory dir;
+
+  // write data
+  {
+    irs::skip_writer writer(skip, skip);
+    size_t doc = 0;
+
+    writer.prepare(
+      max_levels, count,
+      [&doc](size_t, irs::index_output& out) {
+        out.write_vlong(doc);
+    });
+
+    for (; doc <= count; ++doc) {
+      if (doc && 0 == doc % skip) {
+        writer.skip(doc);
+      }
+    }
+
+    ASSERT_EQ(3, writer.num_levels());
+    auto out = dir.create("docs");
+    ASSERT_FALSE(!out);
+    writer.flush(*out);
+  }
+
+  size_t dups = 0;
+  irs::skip_reader reader(skip, skip);
+  {
+    auto in = dir.open("docs", irs::IOAdvice::NORMAL);
+    ASSERT_FALSE(!in);
+    reader.prepare(
+      irs::index_input::make<counting_input>(std::move(in), dups),
+      [](size_t, irs::index_input& in) {
+        if (in.eof()) {
+          return irs::doc_limits::eof();
+        }
+
+        return irs::doc_id_t(in.read_vlong());
+    });
+  }
+
+  // upper levels are in memory, level 0 uses the specified stream
+  ASSERT_EQ(3, reader.num_levels());
+  ASSERT_EQ(0, dups);
+
+  for (irs::doc_id_t target = 1; target < 1920; target += 7) {
+    ASSERT_EQ(((target - 1) / skip) * skip, reader.seek(target));
+  }
+  ASSERT_EQ(0, dups);
+
+  // cached levels are rewound as well
+  reader.reset();
+  ASSERT_EQ(64, reader.seek(70));
+  ASSERT_EQ(64, reader.seek(8)); // doesn't move backwards
+}
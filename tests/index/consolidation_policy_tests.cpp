@@ -1350,3 +1350,139 @@ TEST(consolidation_test_tier, test_skewed_segments) {
   }
   */
 }
+
+TEST(consolidation_test_cost, empty_meta) {
+  irs::index_meta meta;
+  irs::index_writer::consolidating_segments_t consolidating_segments;
+
+  std::vector<irs::index_utils::consolidation_decision> decisions;
+  irs::index_utils::consolidate_cost options;
+  options.on_decision = [&decisions](const irs::index_utils::consolidation_decision& decision) {
+    decisions.emplace_back(decision);
+  };
+  auto policy = irs::index_utils::consolidation_policy(options);
+
+  std::set<const irs::segment_meta*> candidates;
+  policy(candidates, meta, consolidating_segments);
+  ASSERT_TRUE(candidates.empty());
+  ASSERT_EQ(1, decisions.size());
+  ASSERT_TRUE(decisions.front().segments.empty());
+  ASSERT_EQ("nothing to consolidate", decisions.front().reason);
+}
+
+TEST(consolidation_test_cost, reduce_segment_count) {
+  irs::index_meta meta;
+  for (size_t i = 0; i < 12; ++i) {
+    meta.add(irs::segment_meta(std::to_string(i), nullptr, 1, 1, false, irs::segment_meta::file_set(), 1));
+  }
+
+  irs::index_writer::consolidating_segments_t consolidating_segments;
+  irs::index_utils::consolidation_decision last;
+  irs::index_utils::consolidate_cost options;
+  options.on_decision = [&last](const irs::index_utils::consolidation_decision& decision) {
+    last = decision;
+  };
+  auto policy = irs::index_utils::consolidation_policy(options);
+
+  // the more segments are merged at once the better
+  {
+    std::set<const irs::segment_meta*> candidates;
+    policy(candidates, meta, consolidating_segments);
+    ASSERT_EQ(options.max_segments, candidates.size());
+    ASSERT_EQ(candidates.size(), last.segments.size());
+    ASSERT_EQ(10, last.bytes_written);
+    ASSERT_EQ(0, last.bytes_reclaimed);
+    ASSERT_EQ("reduce segment count", last.reason);
+    consolidating_segments.insert(candidates.begin(), candidates.end());
+  }
+
+  {
+    std::set<const irs::segment_meta*> candidates;
+    policy(candidates, meta, consolidating_segments);
+    ASSERT_EQ(2, candidates.size());
+    ASSERT_EQ(10, last.consolidating_bytes);
+    consolidating_segments.insert(candidates.begin(), candidates.end());
+  }
+
+  // nothing left
+  {
+    std::set<const irs::segment_meta*> candidates;
+    policy(candidates, meta, consolidating_segments);
+    ASSERT_TRUE(candidates.empty());
+  }
+}
+
+TEST(consolidation_test_cost, prefer_removals) {
+  irs::index_meta meta;
+  for (size_t i = 0; i < 5; ++i) {
+    meta.add(irs::segment_meta(std::to_string(i), nullptr, 10, 10, false, irs::segment_meta::file_set(), 100));
+  }
+  meta.add(irs::segment_meta("removals", nullptr, 10, 2, false, irs::segment_meta::file_set(), 1000));
+
+  irs::index_writer::consolidating_segments_t consolidating_segments;
+  irs::index_utils::consolidation_decision last;
+  irs::index_utils::consolidate_cost options;
+  options.floor_segment_bytes = 1;
+  options.segment_bytes = 10;
+  options.on_decision = [&last](const irs::index_utils::consolidation_decision& decision) {
+    last = decision;
+  };
+  auto policy = irs::index_utils::consolidation_policy(options);
+
+  std::set<const irs::segment_meta*> candidates;
+  policy(candidates, meta, consolidating_segments);
+  assert_candidates(meta, { 5 }, candidates);
+  ASSERT_EQ(200, last.bytes_written);
+  ASSERT_EQ(800, last.bytes_reclaimed);
+  ASSERT_DOUBLE_EQ(4., last.score);
+  ASSERT_DOUBLE_EQ(0.25, last.write_amplification);
+  ASSERT_EQ("purge removals", last.reason);
+
+  // score is too small
+  options.min_score = 5.;
+  policy = irs::index_utils::consolidation_policy(options);
+  candidates.clear();
+  policy(candidates, meta, consolidating_segments);
+  ASSERT_TRUE(candidates.empty());
+  ASSERT_EQ("no candidates", last.reason);
+}
+
+TEST(consolidation_test_cost, max_consolidating_bytes) {
+  irs::index_meta meta;
+  for (size_t i = 0; i < 22; ++i) {
+    meta.add(irs::segment_meta(std::to_string(i), nullptr, 1, 1, false, irs::segment_meta::file_set(), 1));
+  }
+
+  irs::index_writer::consolidating_segments_t consolidating_segments;
+  irs::index_utils::consolidation_decision last;
+  irs::index_utils::consolidate_cost options;
+  options.max_consolidating_bytes = 7;
+  options.on_decision = [&last](const irs::index_utils::consolidation_decision& decision) {
+    last = decision;
+  };
+  auto policy = irs::index_utils::consolidation_policy(options);
+
+  {
+    std::set<const irs::segment_meta*> candidates;
+    policy(candidates, meta, consolidating_segments);
+    ASSERT_EQ(7, candidates.size());
+    consolidating_segments.insert(candidates.begin(), candidates.end());
+  }
+
+  // merge I/O budget is exhausted
+  {
+    std::set<const irs::segment_meta*> candidates;
+    policy(candidates, meta, consolidating_segments);
+    ASSERT_TRUE(candidates.empty());
+    ASSERT_EQ(7, last.consolidating_bytes);
+    ASSERT_EQ("throttled", last.reason);
+  }
+
+  // consolidation finished
+  {
+    consolidating_segments.clear();
+    std::set<const irs::segment_meta*> candidates;
+    policy(candidates, meta, consolidating_segments);
+    ASSERT_EQ(7, candidates.size());
+  }
+}
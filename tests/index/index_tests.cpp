@@ -2338,6 +2338,94 @@ TEST_P(index_test_case, writer_bulk_insert) {
   writer_bulk_insert();
 }
 
+TEST_P(index_test_case, writer_insert_range) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory
+  );
+
+  std::vector<const tests::document*> docs;
+  for (size_t i = 0; i < 10; ++i) {
+    docs.emplace_back(gen.next());
+    ASSERT_NE(nullptr, docs.back());
+  }
+
+  auto fill = [](irs::segment_writer::document& doc, const tests::document* src) {
+    doc.insert<irs::Action::INDEX>(src->indexed.begin(), src->indexed.end());
+    doc.insert<irs::Action::STORE>(src->stored.begin(), src->stored.end());
+  };
+
+  // whole range goes into a single segment
+  {
+    auto writer = open_writer(irs::OM_CREATE);
+
+    {
+      auto ctx = writer->documents();
+      ASSERT_EQ(docs.end(), ctx.insert(docs.begin(), docs.end(), fill));
+      ASSERT_EQ(docs.end(), ctx.insert(docs.end(), docs.end(), fill)); // empty range
+    }
+
+    ASSERT_EQ(docs.size(), writer->buffered_docs());
+    writer->commit();
+
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(docs.size(), reader.docs_count());
+    ASSERT_EQ(docs.size(), reader.live_docs_count());
+
+    auto& segment = reader[0];
+    const auto* column = segment.column_reader("name");
+    ASSERT_NE(nullptr, column);
+    auto values = column->values();
+    irs::bytes_ref actual_value;
+    irs::doc_id_t id = irs::doc_limits::min();
+
+    for (auto* doc : docs) {
+      ASSERT_TRUE(values(id++, actual_value));
+      auto* field = doc->stored.get<tests::templates::string_field>("name");
+      ASSERT_NE(nullptr, field);
+      ASSERT_EQ(field->value(), irs::to_string<irs::string_ref>(actual_value.c_str()));
+    }
+  }
+
+  // range split over multiple segments, failed document is masked
+  {
+    irs::index_writer::init_options options;
+    options.segment_docs_max = 3;
+    auto writer = open_writer(irs::OM_CREATE, options);
+
+    {
+      auto ctx = writer->documents();
+      auto begin = docs.begin();
+
+      ASSERT_THROW(
+        ctx.insert(begin, docs.end(), [&docs](irs::segment_writer::document& doc, const tests::document* src) {
+          if (src == docs[1]) {
+            throw irs::illegal_state();
+          }
+          doc.insert<irs::Action::INDEX>(src->indexed.begin(), src->indexed.end());
+        }),
+        irs::illegal_state);
+
+      begin += 2; // skip the failed document
+
+      while (begin != docs.end()) {
+        auto end = ctx.insert(begin, docs.end(), fill);
+        ASSERT_NE(begin, end);
+        ASSERT_TRUE(end == docs.end() || 0 == std::distance(docs.begin(), end) % 3);
+        begin = end;
+      }
+    }
+
+    writer->commit();
+
+    auto reader = irs::directory_reader::open(dir(), codec());
+    ASSERT_EQ(4, reader.size());
+    ASSERT_EQ(docs.size(), reader.docs_count());
+    ASSERT_EQ(docs.size() - 1, reader.live_docs_count());
+  }
+}
+
 TEST_P(index_test_case, writer_begin_rollback) {
   writer_begin_rollback();
 }
@@ -7068,6 +7156,53 @@ TEST_P(index_test_case, consolidate_invalid_candidate) {
   }
 }
 
+TEST_P(index_test_case, consolidate_rate_limited) {
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  tests::document const* doc1 = gen.next();
+  tests::document const* doc2 = gen.next();
+
+  irs::index_writer::init_options opts;
+  opts.flush_rate_limiter = std::make_shared<irs::rate_limiter>();
+  opts.merge_rate_limiter = std::make_shared<irs::rate_limiter>();
+
+  auto writer = open_writer(irs::OM_CREATE, opts);
+  ASSERT_NE(nullptr, writer);
+
+  // segment 1
+  ASSERT_TRUE(insert(*writer,
+    doc1->indexed.begin(), doc1->indexed.end(),
+    doc1->stored.begin(), doc1->stored.end()
+  ));
+  writer->commit();
+
+  // segment 2
+  ASSERT_TRUE(insert(*writer,
+    doc2->indexed.begin(), doc2->indexed.end(),
+    doc2->stored.begin(), doc2->stored.end()
+  ));
+  writer->commit();
+
+  // flushes are accounted in the flush limiter only
+  const auto flushed = opts.flush_rate_limiter->bytes();
+  ASSERT_LT(0, flushed);
+  ASSERT_EQ(0, opts.merge_rate_limiter->bytes());
+
+  // consolidate with a budget, the run is paced but completes
+  opts.merge_rate_limiter->bytes_per_sec(1024*1024);
+  ASSERT_TRUE(writer->consolidate(irs::index_utils::consolidation_policy(irs::index_utils::consolidate_count())));
+  writer->commit();
+  ASSERT_EQ(flushed, opts.flush_rate_limiter->bytes());
+  ASSERT_LT(0, opts.merge_rate_limiter->bytes());
+  ASSERT_LT(0., opts.merge_rate_limiter->throughput());
+
+  auto reader = open_reader();
+  ASSERT_EQ(1, reader.size());
+  ASSERT_EQ(2, reader[0].docs_count());
+}
+
 TEST_P(index_test_case, consolidate_single_segment) {
   tests::json_doc_generator gen(
     resource("simple_sequential.json"),
@@ -462,3 +462,103 @@ TEST_F(segment_writer_tests, index_field) {
     writer->commit();
   }
 }
+
+TEST_F(segment_writer_tests, snapshot) {
+  irs::column_info_provider_t column_info = [](const irs::string_ref&) {
+    return irs::column_info( irs::type<irs::compression::lz4>::get(), irs::compression::options{}, true );
+  };
+
+  // collects ids of the live documents containing the specified term
+  auto docs = [](const irs::sub_reader& segment,
+                 const irs::string_ref& field,
+                 const irs::string_ref& term) {
+    std::vector<irs::doc_id_t> docs;
+
+    auto* terms = segment.field(field);
+    if (!terms) {
+      return docs;
+    }
+
+    auto it = terms->iterator();
+    if (!it->seek(irs::ref_cast<irs::byte_type>(term))) {
+      return docs;
+    }
+
+    for (auto postings = segment.mask(it->postings(irs::flags::empty_instance()));
+         postings->next(); ) {
+      docs.emplace_back(postings->value());
+    }
+
+    return docs;
+  };
+
+  auto codec = irs::formats::get("1_1", "1_0");
+  ASSERT_NE(nullptr, codec);
+
+  irs::memory_directory dir;
+  auto writer = irs::segment_writer::make(dir, column_info, nullptr);
+
+  irs::segment_meta segment;
+  segment.name = "foo";
+  segment.codec = codec;
+  writer->reset(segment);
+
+  // nothing buffered yet
+  {
+    auto snapshot = writer->snapshot(codec);
+    ASSERT_NE(nullptr, snapshot);
+    ASSERT_EQ(0, snapshot->docs_count());
+    ASSERT_EQ(nullptr, snapshot->field("name"));
+  }
+
+  auto insert = [&writer](size_t i) {
+    tests::templates::string_field name("name", "doc" + std::to_string(i));
+    tests::templates::string_field parity("parity", i % 2 ? "odd" : "even");
+
+    irs::segment_writer::update_context ctx;
+    const auto doc = writer->begin(ctx);
+    EXPECT_TRUE(writer->insert<irs::Action::INDEX>(name));
+    EXPECT_TRUE(writer->insert<irs::Action::INDEX>(parity));
+    writer->commit();
+    return doc;
+  };
+
+  for (size_t i = 0; i < 10; ++i) {
+    ASSERT_EQ(irs::doc_id_t(irs::doc_limits::min() + i), insert(i));
+  }
+  ASSERT_TRUE(writer->remove(irs::doc_limits::min() + 3));
+
+  auto snapshot = writer->snapshot(codec);
+  ASSERT_NE(nullptr, snapshot);
+  ASSERT_EQ(10, snapshot->docs_count());
+  ASSERT_EQ(9, snapshot->live_docs_count());
+  ASSERT_EQ(std::vector<irs::doc_id_t>{ irs::doc_limits::min() + 5 },
+            docs(*snapshot, "name", "doc5"));
+  ASSERT_TRUE(docs(*snapshot, "name", "doc3").empty());
+  ASSERT_EQ((std::vector<irs::doc_id_t>{ 2, 6, 8, 10 }),
+            docs(*snapshot, "parity", "odd"));
+
+  // buffer more documents, previous snapshot isn't affected
+  for (size_t i = 10; i < 15; ++i) {
+    insert(i);
+  }
+
+  ASSERT_EQ(10, snapshot->docs_count());
+  ASSERT_TRUE(docs(*snapshot, "name", "doc12").empty());
+  ASSERT_EQ((std::vector<irs::doc_id_t>{ 2, 6, 8, 10 }),
+            docs(*snapshot, "parity", "odd"));
+
+  auto next_snapshot = writer->snapshot(codec);
+  ASSERT_NE(nullptr, next_snapshot);
+  ASSERT_EQ(15, next_snapshot->docs_count());
+  ASSERT_EQ(14, next_snapshot->live_docs_count());
+  ASSERT_EQ(std::vector<irs::doc_id_t>{ irs::doc_limits::min() + 12 },
+            docs(*next_snapshot, "name", "doc12"));
+  ASSERT_EQ((std::vector<irs::doc_id_t>{ 2, 6, 8, 10, 12, 14 }),
+            docs(*next_snapshot, "parity", "odd"));
+
+  // snapshot outlives the writer state
+  writer->reset();
+  ASSERT_EQ((std::vector<irs::doc_id_t>{ 2, 6, 8, 10, 12, 14 }),
+            docs(*next_snapshot, "parity", "odd"));
+}
@@ -1924,6 +1924,93 @@ TEST_F(transaction_store_tests, flush_store) {
   }
 }
 
+TEST_F(transaction_store_tests, concurrent_writers) {
+  constexpr size_t THREADS = 8;
+  constexpr size_t DOCS_PER_THREAD = 32;
+
+  irs::transaction_store store;
+  tests::json_doc_generator gen(
+    resource("simple_sequential.json"), &tests::generic_json_field_factory
+  );
+  std::vector<const tests::document*> docs;
+
+  for (const tests::document* doc; (doc = gen.next()) != nullptr; ) {
+    docs.emplace_back(doc);
+  }
+
+  ASSERT_FALSE(docs.empty());
+
+  std::atomic<bool> done(false);
+  std::atomic<size_t> committed(0);
+
+  // readers/cleanup run concurrently with writers of the same fields/columns
+  std::thread reader_thread([&store, &done]()->void {
+    auto reader = store.reader();
+
+    while (!done.load()) {
+      auto new_reader = reader.reopen();
+      ASSERT_TRUE(bool(new_reader));
+      ASSERT_LE(reader.live_docs_count(), new_reader.live_docs_count());
+      reader = new_reader;
+      store.cleanup();
+    }
+  });
+
+  std::vector<std::thread> writer_threads;
+
+  for (size_t i = 0; i < THREADS; ++i) {
+    writer_threads.emplace_back([&store, &docs, &committed, i]()->void {
+      for (size_t j = 0; j < DOCS_PER_THREAD; ++j) {
+        auto* src = docs[(i * DOCS_PER_THREAD + j) % docs.size()];
+        irs::store_writer writer(store);
+
+        ASSERT_TRUE(writer.insert([src](irs::store_writer::document& doc)->bool {
+          doc.insert<irs::Action::INDEX>(src->indexed.begin(), src->indexed.end());
+          doc.insert<irs::Action::STORE>(src->stored.begin(), src->stored.end());
+          return false;
+        }));
+        ASSERT_TRUE(writer.commit());
+        ++committed;
+      }
+    });
+  }
+
+  for (auto& thread: writer_threads) {
+    thread.join();
+  }
+
+  done = true;
+  reader_thread.join();
+
+  ASSERT_EQ(THREADS * DOCS_PER_THREAD, committed.load());
+
+  // check documents
+  {
+    auto reader = store.reader();
+    ASSERT_EQ(1, reader.size());
+    ASSERT_EQ(THREADS * DOCS_PER_THREAD, reader.live_docs_count());
+
+    auto& segment = *(reader.begin());
+    auto terms = segment.field("same");
+    ASSERT_NE(nullptr, terms);
+    ASSERT_EQ(THREADS * DOCS_PER_THREAD, terms->docs_count());
+
+    const auto* column = segment.column_reader("name");
+    ASSERT_NE(nullptr, column);
+    auto values = column->values();
+    auto docs_itr = segment.docs_iterator();
+    irs::bytes_ref actual_value;
+    size_t count = 0;
+
+    while (docs_itr->next()) {
+      ASSERT_TRUE(values(docs_itr->value(), actual_value));
+      ++count;
+    }
+
+    ASSERT_EQ(THREADS * DOCS_PER_THREAD, count);
+  }
+}
+
 TEST_F(transaction_store_tests, read_empty_doc_attributes) {
   irs::transaction_store store;
   tests::json_doc_generator gen(
@@ -1074,6 +1074,116 @@ TEST_F(IqlQueryBuilderTestSuite, test_query_builder_sequence_fns) {
   }
 }
 
+TEST_F(IqlQueryBuilderTestSuite, test_query_plan) {
+  iresearch::memory_directory dir;
+  auto reader = load_json(dir, "simple_sequential.json");
+  ASSERT_EQ(1, reader.size());
+  auto& segment = reader[0]; // assume 0 is id of first/only segment
+  auto column = segment.column_reader("name");
+  ASSERT_NE(nullptr, column);
+  auto values = column->values();
+
+  auto names = [&](const irs::iql::query& query) {
+    std::vector<std::string> result;
+    irs::bytes_ref actual_value;
+    auto pQuery = query.filter->prepare(reader);
+    EXPECT_NE(nullptr, pQuery.get());
+
+    for (auto docsItr = pQuery->execute(segment); docsItr->next();) {
+      EXPECT_TRUE(values(docsItr->value(), actual_value));
+      result.emplace_back(irs::to_string<irs::string_ref>(actual_value.c_str()));
+    }
+
+    return result;
+  };
+
+  // same plan with different values
+  {
+    auto plan = query_builder().compile(
+      "name==$value || name==($min, $max) limit 5", std::locale::classic()
+    );
+    ASSERT_NE(nullptr, plan);
+
+    auto query = plan->build({ { "value", "A" }, { "min", "A" }, { "max", "C" } });
+    ASSERT_NE(nullptr, query.filter.get());
+    ASSERT_EQ(nullptr, query.error);
+    ASSERT_NE(nullptr, query.limit);
+    ASSERT_EQ(5, *(query.limit));
+    ASSERT_EQ((std::vector<std::string>{ "A", "B" }), names(query));
+
+    auto other_query = plan->build({ { "value", "D" }, { "min", "D" }, { "max", "G" } });
+    ASSERT_EQ(nullptr, other_query.error);
+    ASSERT_EQ((std::vector<std::string>{ "D", "E", "F" }), names(other_query));
+
+    // unbound placeholder
+    auto unbound_query = plan->build({ { "value", "A" } });
+    ASSERT_NE(nullptr, unbound_query.error);
+    ASSERT_EQ(0, unbound_query.error->find("filter conversion error"));
+    ASSERT_EQ(nullptr, unbound_query.filter->prepare(reader).get());
+  }
+
+  // quoted sequences are literals
+  {
+    auto plan = query_builder().compile("name=='$value'", std::locale::classic());
+    auto query = plan->build({ { "value", "A" } });
+    ASSERT_EQ(nullptr, query.error);
+    ASSERT_TRUE(names(query).empty());
+  }
+
+  // placeholders are passed to contextual functions
+  {
+    sequence_function::contextual_function_t fnValue = [](
+      sequence_function::contextual_buffer_t& buf,
+      const std::locale& locale,
+      void* cookie,
+      const sequence_function::contextual_function_args_t& args
+    )->bool {
+      bool bNil;
+      return args.size() == 1 && args[0].value(buf, bNil, locale, cookie);
+    };
+    sequence_function seq_function(fnValue, 1);
+    sequence_functions seq_functions = {
+      { "valueOf", seq_function },
+    };
+    functions functions(seq_functions);
+    auto plan = query_builder(functions).compile("name==valueOf($v)", std::locale::classic());
+    auto query = plan->build({ { "v", "C" } });
+    ASSERT_EQ(nullptr, query.error);
+    ASSERT_EQ((std::vector<std::string>{ "C" }), names(query));
+  }
+
+  // parse errors are reported on build
+  {
+    auto plan = query_builder().compile("name==$value bcd", std::locale::classic());
+    ASSERT_NE(nullptr, plan);
+    auto query = plan->build({ { "value", "A" } });
+    ASSERT_NE(nullptr, query.error);
+    ASSERT_NE(std::string::npos, query.error->find("syntax error"));
+  }
+
+  // plans are reused until evicted
+  {
+    query_builder builder;
+    query_plan_cache cache(builder, 2);
+    auto plan1 = cache.get("name==$a", std::locale::classic());
+    ASSERT_EQ(plan1, cache.get("name==$a", std::locale::classic()));
+    auto plan2 = cache.get("name==$b", std::locale::classic());
+    ASSERT_EQ(plan1, cache.get("name==$a", std::locale::classic())); // most recently used
+    cache.get("name==$c", std::locale::classic()); // evicts 'plan2'
+    ASSERT_EQ(2, cache.size());
+    ASSERT_EQ(plan1, cache.get("name==$a", std::locale::classic()));
+    ASSERT_NE(plan2, cache.get("name==$b", std::locale::classic()));
+    ASSERT_EQ(2, cache.size());
+
+    auto query = plan1->build({ { "a", "B" } });
+    ASSERT_EQ(nullptr, query.error);
+    ASSERT_EQ((std::vector<std::string>{ "B" }), names(query));
+
+    cache.clear();
+    ASSERT_EQ(0, cache.size());
+  }
+}
+
 TEST_F(IqlQueryBuilderTestSuite, test_query_builder_order) {
   iresearch::memory_directory dir;
   auto reader = load_json(dir, "simple_sequential.json");
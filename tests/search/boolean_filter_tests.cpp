@@ -36,6 +36,7 @@
 #include "formats/formats.hpp"
 #include "search/term_filter.hpp"
 #include "search/term_query.hpp"
+#include "search/multiterm_query.hpp"
 
 #include <functional>
 
@@ -4489,6 +4490,250 @@ TEST(disjunction_test, scored_seek_next) {
   }
 }
 
+// ----------------------------------------------------------------------------
+// --SECTION--                             Block disjunction (window based)
+// ----------------------------------------------------------------------------
+
+TEST(block_disjunction_test, next) {
+  using disjunction = irs::block_disjunction<irs::doc_iterator::ptr>;
+  auto sum = [](size_t sum, const std::vector<irs::doc_id_t>& docs) { return sum += docs.size(); };
+
+  // empty
+  {
+    std::vector<std::vector<irs::doc_id_t>> docs;
+    disjunction it(detail::execute_all<disjunction::doc_iterator_t>(docs));
+    ASSERT_EQ(irs::doc_limits::eof(), it.value());
+    ASSERT_FALSE(it.next());
+    ASSERT_EQ(irs::doc_limits::eof(), it.value());
+  }
+
+  // documents spanning multiple windows
+  {
+    std::vector<std::vector<irs::doc_id_t>> docs{
+      { 1, 2, 5, 7, 9, 11, 45, 2047, 2048, 2049, 10000 },
+      { 1, 5, 6, 12, 29, 4095, 4096, 4097 },
+      { 1, 5, 6, 65, 127, 128, 129, 64000 },
+      { },
+      { 63, 64, 2048, 6143, 6144, 6145 }
+    };
+
+    disjunction it(detail::execute_all<disjunction::doc_iterator_t>(docs));
+    ASSERT_EQ(std::accumulate(docs.begin(), docs.end(), size_t(0), sum), irs::cost::extract(it));
+    ASSERT_TRUE(irs::score::get(it).empty());
+
+    std::vector<irs::doc_id_t> result;
+    ASSERT_EQ(irs::doc_limits::invalid(), it.value());
+    while (it.next()) {
+      result.push_back(it.value());
+    }
+    ASSERT_EQ(detail::union_all(docs), result);
+    ASSERT_FALSE(it.next());
+    ASSERT_EQ(irs::doc_limits::eof(), it.value());
+  }
+}
+
+TEST(block_disjunction_test, seek_next) {
+  using disjunction = irs::block_disjunction<irs::doc_iterator::ptr>;
+
+  std::vector<std::vector<irs::doc_id_t>> docs{
+    { 1, 2, 5, 7, 9, 11, 45, 2047, 2048, 2049, 10000 },
+    { 1, 5, 6, 12, 29, 4095, 4096, 4097 },
+    { 1, 5, 6 }
+  };
+
+  disjunction it(detail::execute_all<disjunction::doc_iterator_t>(docs));
+  ASSERT_EQ(irs::doc_limits::invalid(), it.value());
+  ASSERT_EQ(5, it.seek(5));
+  ASSERT_EQ(5, it.seek(3)); // seek backwards
+  ASSERT_TRUE(it.next());
+  ASSERT_EQ(6, it.value());
+  ASSERT_TRUE(it.next());
+  ASSERT_EQ(7, it.value());
+  ASSERT_EQ(29, it.seek(27)); // within the window
+  ASSERT_TRUE(it.next());
+  ASSERT_EQ(45, it.value());
+  ASSERT_EQ(2048, it.seek(2048)); // beyond the window
+  ASSERT_TRUE(it.next());
+  ASSERT_EQ(2049, it.value());
+  ASSERT_EQ(4095, it.seek(2050));
+  ASSERT_EQ(10000, it.seek(4098));
+  ASSERT_FALSE(it.next());
+  ASSERT_EQ(irs::doc_limits::eof(), it.value());
+  ASSERT_EQ(irs::doc_limits::eof(), it.seek(10001));
+}
+
+TEST(block_disjunction_test, scored_seek_next) {
+  using disjunction = irs::block_disjunction<irs::doc_iterator::ptr>;
+
+  std::vector<std::pair<std::vector<irs::doc_id_t>, irs::order>> docs;
+  {
+    irs::order ord;
+    ord.add<detail::basic_sort>(false, 1);
+    docs.emplace_back(std::vector<irs::doc_id_t>{ 1, 2, 5, 7, 9, 11, 45, 3000 }, std::move(ord));
+  }
+  {
+    irs::order ord;
+    ord.add<detail::basic_sort>(false, 2);
+    docs.emplace_back(std::vector<irs::doc_id_t>{ 1, 5, 6, 12, 29, 3000 }, std::move(ord));
+  }
+  {
+    docs.emplace_back(std::vector<irs::doc_id_t>{ 1, 5, 6, 8 }, irs::order{}); // no score
+  }
+
+  // aggregate
+  {
+    irs::order ord;
+    ord.add<detail::basic_sort>(false, std::numeric_limits<size_t>::max());
+    auto prepared_order = ord.prepare();
+
+    auto res = detail::execute_all<disjunction::doc_iterator_t>(docs);
+    disjunction it(std::move(res.first), prepared_order, irs::sort::MergeType::AGGREGATE, 1); // custom cost
+    ASSERT_EQ(1, irs::cost::extract(it));
+
+    auto& score = irs::score::get(it);
+    ASSERT_FALSE(score.empty());
+    ASSERT_EQ(&score, irs::get_mutable<irs::score>(&it));
+
+    ASSERT_TRUE(it.next());
+    ASSERT_EQ(1, it.value());
+    score.evaluate();
+    ASSERT_EQ(3, *reinterpret_cast<const size_t*>(score.c_str())); // 1+2
+    ASSERT_EQ(5, it.seek(5));
+    score.evaluate();
+    ASSERT_EQ(3, *reinterpret_cast<const size_t*>(score.c_str())); // 1+2
+    ASSERT_TRUE(it.next());
+    ASSERT_EQ(6, it.value());
+    score.evaluate();
+    ASSERT_EQ(2, *reinterpret_cast<const size_t*>(score.c_str())); // 2
+    ASSERT_TRUE(it.next());
+    ASSERT_EQ(7, it.value());
+    score.evaluate();
+    ASSERT_EQ(1, *reinterpret_cast<const size_t*>(score.c_str())); // 1
+    ASSERT_TRUE(it.next());
+    ASSERT_EQ(8, it.value());
+    score.evaluate();
+    ASSERT_EQ(0, *reinterpret_cast<const size_t*>(score.c_str())); // no score
+    ASSERT_EQ(3000, it.seek(2100));
+    score.evaluate();
+    ASSERT_EQ(3, *reinterpret_cast<const size_t*>(score.c_str())); // 1+2
+    ASSERT_FALSE(it.next());
+    ASSERT_EQ(irs::doc_limits::eof(), it.value());
+  }
+
+  // max
+  {
+    irs::order ord;
+    ord.add<detail::basic_sort>(false, std::numeric_limits<size_t>::max());
+    auto prepared_order = ord.prepare();
+
+    auto res = detail::execute_all<disjunction::doc_iterator_t>(docs);
+    disjunction it(std::move(res.first), prepared_order, irs::sort::MergeType::MAX, 1); // custom cost
+
+    auto& score = irs::score::get(it);
+    ASSERT_FALSE(score.empty());
+
+    ASSERT_TRUE(it.next());
+    ASSERT_EQ(1, it.value());
+    score.evaluate();
+    ASSERT_EQ(2, *reinterpret_cast<const size_t*>(score.c_str())); // max(1, 2)
+    ASSERT_TRUE(it.next());
+    ASSERT_EQ(2, it.value());
+    score.evaluate();
+    ASSERT_EQ(1, *reinterpret_cast<const size_t*>(score.c_str())); // 1
+    ASSERT_EQ(3000, it.seek(2100));
+    score.evaluate();
+    ASSERT_EQ(2, *reinterpret_cast<const size_t*>(score.c_str())); // max(1, 2)
+    ASSERT_FALSE(it.next());
+  }
+}
+
+TEST(block_disjunction_test, make_disjunction_wide) {
+  using disjunction = irs::disjunction<irs::doc_iterator::ptr>;
+  using conjunction = irs::conjunction<irs::doc_iterator::ptr>;
+
+  // counts documents the wrapped iterator is moved through by 'next()'
+  class next_counter final : public irs::doc_iterator {
+   public:
+    next_counter(irs::doc_iterator::ptr&& it, size_t& nexts) noexcept
+      : it_(std::move(it)), nexts_(&nexts) {
+    }
+
+    virtual irs::doc_id_t value() const override { return it_->value(); }
+    virtual bool next() override {
+      ++*nexts_;
+      return it_->next();
+    }
+    virtual irs::doc_id_t seek(irs::doc_id_t target) override {
+      return it_->seek(target);
+    }
+    virtual irs::attribute* get_mutable(irs::type_info::type_id type) override {
+      return it_->get_mutable(type);
+    }
+
+   private:
+    irs::doc_iterator::ptr it_;
+    size_t* nexts_;
+  };
+
+  constexpr size_t NUM_ITRS = 20;
+  constexpr irs::doc_id_t NUM_DOCS = 100000;
+
+  // i-th iterator matches every NUM_ITRS-th document starting from i+1
+  std::vector<std::vector<irs::doc_id_t>> docs(NUM_ITRS);
+  for (irs::doc_id_t doc = 1; doc <= NUM_DOCS; ++doc) {
+    docs[(doc - 1) % NUM_ITRS].push_back(doc);
+  }
+
+  // lead of a conjunction: every 10000th document
+  std::vector<irs::doc_id_t> lead;
+  for (irs::doc_id_t doc = 10000; doc <= NUM_DOCS; doc += 10000) {
+    lead.push_back(doc);
+  }
+
+  auto make_itrs = [&docs](size_t& nexts) {
+    disjunction::doc_iterators_t itrs;
+    for (auto& entry : docs) {
+      itrs.emplace_back(irs::doc_iterator::make<next_counter>(
+        irs::doc_iterator::make<detail::basic_doc_iterator>(entry.begin(), entry.end()),
+        nexts));
+    }
+    return itrs;
+  };
+
+  // top-level disjunction, driven by 'next()'
+  {
+    size_t nexts = 0;
+    auto it = irs::make_disjunction<disjunction>(make_itrs(nexts));
+    ASSERT_NE(nullptr, dynamic_cast<disjunction::block_disjunction_t*>(it.get()));
+
+    std::vector<irs::doc_id_t> result;
+    while (it->next()) {
+      result.push_back(it->value());
+    }
+    ASSERT_EQ(detail::union_all(docs), result);
+    ASSERT_TRUE(irs::doc_limits::eof(it->value()));
+  }
+
+  // disjunction inside of a conjunction, driven by 'seek(...)'
+  {
+    size_t nexts = 0;
+    std::vector<conjunction::doc_iterator_t> itrs;
+    itrs.emplace_back(irs::doc_iterator::make<detail::basic_doc_iterator>(lead.begin(), lead.end()));
+    itrs.emplace_back(irs::make_disjunction<disjunction>(make_itrs(nexts)));
+
+    conjunction it(std::move(itrs));
+    std::vector<irs::doc_id_t> result;
+    while (it.next()) {
+      result.push_back(it.value());
+    }
+    ASSERT_EQ(lead, result);
+    ASSERT_TRUE(irs::doc_limits::eof(it.value()));
+
+    // sub-iterators aren't drained into a window on every seek
+    ASSERT_LE(nexts, NUM_ITRS * (lead.size() + 1));
+  }
+}
+
 // ----------------------------------------------------------------------------
 // --SECTION--  Minimum match count: iterator0 OR iterator1 OR iterator2 OR ...
 // ----------------------------------------------------------------------------
@@ -6442,6 +6687,76 @@ TEST(conjunction_test, seek) {
   }
 }
 
+TEST(conjunction_test, adaptive_tail) {
+  using conjunction = irs::conjunction<irs::doc_iterator::ptr>;
+
+  // counts seeks of the wrapped iterator
+  class seek_counter final : public irs::doc_iterator {
+   public:
+    seek_counter(irs::doc_iterator::ptr&& it, size_t& seeks) noexcept
+      : it_(std::move(it)), seeks_(&seeks) {
+    }
+
+    virtual irs::doc_id_t value() const override { return it_->value(); }
+    virtual bool next() override { return it_->next(); }
+    virtual irs::doc_id_t seek(irs::doc_id_t target) override {
+      ++*seeks_;
+      return it_->seek(target);
+    }
+    virtual irs::attribute* get_mutable(irs::type_info::type_id type) override {
+      return it_->get_mutable(type);
+    }
+
+   private:
+    irs::doc_iterator::ptr it_;
+    size_t* seeks_;
+  };
+
+  // lead: every 2nd document
+  // cheap: every document, never rejects a candidate
+  // selective: more expensive, but rejects most of the candidates
+  std::vector<std::vector<irs::doc_id_t>> docs(3);
+  for (irs::doc_id_t i = 1; i <= 1000; ++i) {
+    if (0 == i % 2) docs[0].push_back(i);
+    docs[1].push_back(i);
+  }
+  for (irs::doc_id_t i = 1; i <= 2000; ++i) {
+    docs[2].push_back(0 == i % 50 ? i : 1000 + i);
+  }
+  std::sort(docs[2].begin(), docs[2].end());
+  docs[2].erase(std::unique(docs[2].begin(), docs[2].end()), docs[2].end());
+  ASSERT_LT(docs[1].size(), docs[2].size());
+
+  std::vector<irs::doc_id_t> expected;
+  std::set_intersection(docs[0].begin(), docs[0].end(),
+                        docs[2].begin(), docs[2].end(),
+                        std::back_inserter(expected));
+  ASSERT_FALSE(expected.empty());
+
+  std::vector<size_t> seeks(docs.size(), 0);
+  std::vector<conjunction::doc_iterator_t> itrs;
+  for (size_t i = 0; i < docs.size(); ++i) {
+    itrs.emplace_back(irs::doc_iterator::make<seek_counter>(
+      irs::doc_iterator::make<detail::basic_doc_iterator>(docs[i].begin(), docs[i].end()),
+      seeks[i]));
+  }
+
+  std::vector<irs::doc_id_t> result;
+  {
+    conjunction it(std::move(itrs));
+    while (it.next()) {
+      result.push_back(it.value());
+    }
+    ASSERT_TRUE(irs::doc_limits::eof(it.value()));
+  }
+
+  ASSERT_EQ(expected, result);
+
+  // 'selective' is moved in front of 'cheap' after the very first rejection,
+  // hence 'cheap' is sought only for the candidates accepted by 'selective'
+  ASSERT_LE(seeks[1], expected.size() + 1);
+}
+
 TEST(conjunction_test, seek_next) {
   using conjunction = irs::conjunction<irs::doc_iterator::ptr>;
   auto shortest = [](const std::vector<irs::doc_id_t>& lhs, const std::vector<irs::doc_id_t>& rhs) {
@@ -7457,6 +7772,123 @@ TEST_P(boolean_filter_test_case, and_sequential) {
   }
 }
 
+TEST_P(boolean_filter_test_case, rewrite_sequential) {
+  // add segment
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    add_segment( gen );
+  }
+
+  auto rdr = open_reader();
+
+  // nested conjunctions: duplicated=abcd AND (same=xyz AND (name=A))
+  {
+    irs::And root;
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    auto& sub = root.add<irs::And>();
+    append<irs::by_term>(sub, "same", "xyz"); // 1..32
+    append<irs::by_term>(sub.add<irs::And>(), "name", "A"); // 1
+    check_query(root, docs_t{ 1 }, rdr);
+  }
+
+  // nested negation: duplicated=abcd AND (NOT name=A)
+  {
+    irs::And root;
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    root.add<irs::And>().add<irs::Not>().filter<irs::by_term>() = make_filter<irs::by_term>("name", "A");
+    check_query(root, docs_t{ 5, 11, 21, 27, 31 }, rdr);
+  }
+
+  // empty nested conjunction: duplicated=abcd AND ()
+  {
+    irs::And root;
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    root.add<irs::And>();
+    check_query(root, docs_t{}, rdr);
+  }
+
+  // missing term: same=xyz AND name=invalid_term
+  {
+    irs::And root;
+    append<irs::by_term>(root, "same", "xyz"); // 1..32
+    append<irs::by_term>(root, "name", "invalid_term");
+    check_query(root, docs_t{}, rdr);
+  }
+
+  // nested disjunctions over the same field: name=A OR (name=Q OR (name=Z))
+  {
+    irs::Or root;
+    append<irs::by_term>(root, "name", "A"); // 1
+    auto& sub = root.add<irs::Or>();
+    append<irs::by_term>(sub, "name", "Q"); // 17
+    append<irs::by_term>(sub.add<irs::Or>(), "name", "Z"); // 26
+    check_query(root, docs_t{ 1, 17, 26 }, rdr);
+  }
+
+  // duplicate terms: name=A OR name=A OR name=Q OR duplicated=abcd
+  {
+    irs::Or root;
+    append<irs::by_term>(root, "name", "A"); // 1
+    append<irs::by_term>(root, "name", "A"); // 1
+    append<irs::by_term>(root, "name", "Q"); // 17
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    check_query(root, docs_t{ 1, 5, 11, 17, 21, 27, 31 }, rdr);
+  }
+
+  // min match: 2 of (duplicated=abcd, name=A OR name=E, name=E)
+  {
+    irs::Or root;
+    root.min_match_count(2);
+    append<irs::by_term>(root, "duplicated", "abcd"); // 1,5,11,21,27,31
+    auto& sub = root.add<irs::Or>();
+    append<irs::by_term>(sub, "name", "A"); // 1
+    append<irs::by_term>(sub, "name", "E"); // 5
+    append<irs::by_term>(root, "name", "E"); // 5
+    check_query(root, docs_t{ 1, 5 }, rdr);
+  }
+
+  // negated disjunction: same=xyz AND NOT (name=A OR name=Q OR duplicated=abcd)
+  {
+    irs::And root;
+    append<irs::by_term>(root, "same", "xyz"); // 1..32
+    auto& sub = root.add<irs::Not>().filter<irs::Or>();
+    append<irs::by_term>(sub, "name", "A"); // 1
+    append<irs::by_term>(sub, "name", "Q"); // 17
+    append<irs::by_term>(sub, "duplicated", "abcd"); // 1,5,11,21,27,31
+    check_query(root, docs_t{ 2, 3, 4, 6, 7, 8, 9, 10, 12, 13, 14, 15, 16,
+                              18, 19, 20, 22, 23, 24, 25, 26, 28, 29, 30, 32 }, rdr);
+  }
+
+  // merged terms are scored as separate ones
+  {
+    irs::order ord;
+    ord.add<irs::bm25_sort>(false);
+    auto prepared_ord = ord.prepare();
+
+    auto score = [&rdr, &prepared_ord](const irs::filter& filter) {
+      auto prepared = filter.prepare(*rdr, prepared_ord);
+      auto docs = prepared->execute((*rdr)[0], prepared_ord);
+      auto* scr = irs::get<irs::score>(*docs);
+      EXPECT_NE(nullptr, scr);
+      EXPECT_TRUE(docs->next());
+      EXPECT_EQ(1, docs->value());
+      scr->evaluate();
+      return prepared_ord.get<irs::bm25_sort::score_t>(scr->c_str(), 0);
+    };
+
+    irs::Or root;
+    append<irs::by_term>(root, "name", "A").boost(2.f); // 1
+    append<irs::by_term>(root, "name", "Q"); // 17
+
+    auto term = make_filter<irs::by_term>("name", "A");
+    term.boost(2.f);
+
+    ASSERT_FLOAT_EQ(score(term), score(root));
+  }
+}
+
 TEST_P(boolean_filter_test_case, not_standalone_sequential_ordered) {
   // add segment
   {
@@ -8229,6 +8661,15 @@ TEST(And_test, optimize_all_filters) {
   }
 }
 
+TEST(And_test, optimize_missing_term) {
+  irs::And root;
+  append<irs::by_term>(root, "test_field", "test_term0");
+  append<irs::by_term>(root, "test_field", "test_term1");
+
+  auto prepared = root.prepare(irs::sub_reader::empty());
+  ASSERT_EQ(irs::filter::prepared::empty().get(), prepared.get());
+}
+
 #endif // IRESEARCH_DLL
 
 // ----------------------------------------------------------------------------
@@ -8324,6 +8765,41 @@ TEST(Or_test, optimize_single_node) {
   }
 }
 
+TEST(Or_test, optimize_same_field_terms) {
+  // nested disjunctions
+  {
+    irs::Or root;
+    append<irs::by_term>(root.add<irs::Or>(), "test_field", "test_term0");
+    append<irs::by_term>(root.add<irs::Or>(), "test_field", "test_term1");
+
+    auto prepared = root.prepare(irs::sub_reader::empty());
+    ASSERT_NE(nullptr, dynamic_cast<const irs::multiterm_query*>(prepared.get()));
+  }
+
+  // boosted nested disjunction isn't flattened
+  {
+    irs::Or root;
+    append<irs::by_term>(root, "test_field", "test_term0");
+    auto& sub = root.add<irs::Or>();
+    sub.boost(2.f);
+    append<irs::by_term>(sub, "test_field", "test_term1");
+
+    auto prepared = root.prepare(irs::sub_reader::empty());
+    ASSERT_EQ(nullptr, dynamic_cast<const irs::multiterm_query*>(prepared.get()));
+  }
+
+  // min match disjunction
+  {
+    irs::Or root;
+    root.min_match_count(2);
+    append<irs::by_term>(root, "test_field", "test_term0");
+    append<irs::by_term>(root, "test_field", "test_term1");
+
+    auto prepared = root.prepare(irs::sub_reader::empty());
+    ASSERT_EQ(nullptr, dynamic_cast<const irs::multiterm_query*>(prepared.get()));
+  }
+}
+
 #endif // IRESEARCH_DLL
 
 INSTANTIATE_TEST_CASE_P(
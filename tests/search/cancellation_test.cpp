@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "tests_shared.hpp"
+#include "filter_test_case_base.hpp"
+#include "search/bitset_doc_iterator.hpp"
+#include "search/cancellation.hpp"
+#include "search/filter_visitor.hpp"
+#include "search/prefix_filter.hpp"
+#include "utils/bitset.hpp"
+
+NS_LOCAL
+
+struct cancellation_context final : irs::attribute_provider {
+  virtual irs::attribute* get_mutable(irs::type_info::type_id type) override {
+    return type == irs::type<irs::cancellation>::id() ? &token : nullptr;
+  }
+
+  irs::cancellation token;
+};
+
+// asks to stop term enumeration after the specified number of terms
+class limited_visitor final : public irs::filter_visitor {
+ public:
+  explicit limited_visitor(size_t limit) noexcept
+    : limit_(limit) {
+  }
+
+  virtual void prepare(
+      const irs::sub_reader&,
+      const irs::term_reader&,
+      const irs::seek_term_iterator&) noexcept override {
+  }
+
+  virtual bool visit(irs::boost_t) noexcept override {
+    return ++visited_ < limit_;
+  }
+
+  size_t visited() const noexcept { return visited_; }
+
+ private:
+  size_t limit_;
+  size_t visited_{};
+};
+
+NS_END
+
+TEST(cancellation_test, ctor) {
+  irs::cancellation token;
+  ASSERT_EQ(irs::cancellation::clock_t::time_point::max(), token.deadline());
+  ASSERT_FALSE(token.check());
+  ASSERT_FALSE(token.interrupted());
+}
+
+TEST(cancellation_test, cancel) {
+  irs::cancellation token;
+  ASSERT_FALSE(token.interrupted());
+  token.cancel();
+  ASSERT_FALSE(token.interrupted()); // nobody observed cancellation yet
+  ASSERT_TRUE(token.check());
+  ASSERT_TRUE(token.interrupted());
+}
+
+TEST(cancellation_test, deadline) {
+  {
+    irs::cancellation token(std::chrono::hours(1));
+    ASSERT_FALSE(token.check());
+    ASSERT_FALSE(token.interrupted());
+  }
+
+  {
+    irs::cancellation token;
+    token.deadline(irs::cancellation::clock_t::now());
+    ASSERT_TRUE(token.check());
+    ASSERT_TRUE(token.interrupted());
+  }
+}
+
+TEST(cancellation_test, extract) {
+  ASSERT_EQ(nullptr, irs::cancellation::extract(nullptr));
+
+  cancellation_context ctx;
+  ASSERT_EQ(&ctx.token, irs::cancellation::extract(&ctx));
+
+  irs::cancellation_mask mask(&ctx);
+  ASSERT_EQ(nullptr, irs::cancellation::extract(&mask));
+
+  irs::cancellation_mask empty_mask(nullptr);
+  ASSERT_EQ(nullptr, irs::cancellation::extract(&empty_mask));
+}
+
+TEST(cancellation_test, make_cancellable) {
+  irs::bitset bs(4*irs::cancellable_doc_iterator::BLOCK_SIZE);
+  for (size_t i = irs::doc_limits::min(); i < bs.size(); ++i) {
+    bs.set(i);
+  }
+
+  // no token
+  {
+    auto it = irs::doc_iterator::make<irs::bitset_doc_iterator>(bs);
+    auto* expected = it.get();
+    ASSERT_EQ(expected, irs::make_cancellable(std::move(it), nullptr).get());
+  }
+
+  // token is never fired
+  {
+    cancellation_context ctx;
+    auto it = irs::make_cancellable(
+      irs::doc_iterator::make<irs::bitset_doc_iterator>(bs), &ctx);
+    auto* doc = irs::get<irs::document>(*it);
+    ASSERT_NE(nullptr, doc);
+
+    size_t count = 0;
+    while (it->next()) {
+      ASSERT_EQ(it->value(), doc->value);
+      ++count;
+    }
+    ASSERT_EQ(bs.size() - irs::doc_limits::min(), count);
+    ASSERT_TRUE(irs::doc_limits::eof(it->value()));
+    ASSERT_FALSE(ctx.token.interrupted());
+  }
+
+  // token is fired in the middle of iteration
+  {
+    cancellation_context ctx;
+    auto it = irs::make_cancellable(
+      irs::doc_iterator::make<irs::bitset_doc_iterator>(bs), &ctx);
+    auto* doc = irs::get<irs::document>(*it);
+    ASSERT_NE(nullptr, doc);
+
+    ASSERT_TRUE(it->next());
+    ASSERT_EQ(irs::doc_limits::min(), it->value());
+    ctx.token.cancel();
+
+    size_t count = 1;
+    while (it->next()) {
+      ++count;
+    }
+    ASSERT_EQ(irs::cancellable_doc_iterator::BLOCK_SIZE - 1, count);
+    ASSERT_TRUE(irs::doc_limits::eof(it->value()));
+    ASSERT_TRUE(irs::doc_limits::eof(doc->value));
+    ASSERT_TRUE(ctx.token.interrupted());
+    ASSERT_TRUE(irs::doc_limits::eof(it->seek(irs::doc_limits::min())));
+  }
+}
+
+class cancellation_filter_test_case : public tests::filter_test_case_base { };
+
+TEST_P(cancellation_filter_test_case, by_prefix) {
+  // add segment
+  {
+    tests::json_doc_generator gen(
+      resource("simple_sequential.json"),
+      &tests::generic_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto rdr = open_reader();
+
+  irs::by_prefix q;
+  *q.mutable_field() = "prefix";
+
+  // token is never fired
+  {
+    cancellation_context ctx;
+    auto prepared = q.prepare(rdr, irs::order::prepared::unordered(), &ctx);
+    auto docs = prepared->execute(rdr[0], irs::order::prepared::unordered(), &ctx);
+
+    size_t count = 0;
+    while (docs->next()) {
+      ++count;
+    }
+    ASSERT_EQ(10, count);
+    ASSERT_FALSE(ctx.token.interrupted());
+  }
+
+  // token is fired before term enumeration
+  {
+    cancellation_context ctx;
+    ctx.token.cancel();
+    auto prepared = q.prepare(rdr, irs::order::prepared::unordered(), &ctx);
+    auto docs = prepared->execute(rdr[0], irs::order::prepared::unordered(), &ctx);
+    ASSERT_FALSE(docs->next());
+    ASSERT_TRUE(ctx.token.interrupted());
+  }
+
+  // visitor stops term enumeration
+  {
+    auto& segment = rdr[0];
+    auto* field = segment.field("prefix");
+    ASSERT_NE(nullptr, field);
+    ASSERT_LT(3, field->size());
+
+    limited_visitor visitor(3);
+    irs::by_prefix::visit(segment, *field, irs::bytes_ref::EMPTY, visitor);
+    ASSERT_EQ(3, visitor.visited());
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+  cancellation_filter_test,
+  cancellation_filter_test_case,
+  ::testing::Combine(
+    ::testing::Values(&tests::memory_directory),
+    ::testing::Values(tests::format_info{"1_0"})),
+  tests::to_string
+);
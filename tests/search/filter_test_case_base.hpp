@@ -646,10 +646,11 @@ class empty_filter_visitor : public irs::filter_visitor {
     ++prepare_calls_counter_;
   }
 
-  virtual void visit(irs::boost_t boost) noexcept override {
-    ASSERT_NE(nullptr, it_);
+  virtual bool visit(irs::boost_t boost) noexcept override {
+    EXPECT_NE(nullptr, it_);
     terms_.emplace_back(it_->value(), boost);
     ++visit_calls_counter_;
+    return true;
   }
 
   void reset() noexcept {
@@ -25,12 +25,15 @@
 #include "index/index_reader.hpp"
 #include "formats/formats_10.hpp"
 #include "index/index_writer.hpp"
+#include "index/reader_refresher.hpp"
 #include "store/memory_directory.hpp"
 #include "index/doc_generator.hpp"
 #include "index/index_tests.hpp"
 #include "utils/version_utils.hpp"
 #include "utils/utf8_path.hpp"
 
+#include <thread>
+
 NS_LOCAL
 
 irs::format* codec0;
@@ -322,6 +325,65 @@ TEST(directory_reader_test, open) {
   ASSERT_EQ(rdr.end(), sub);
 }
 
+TEST(directory_reader_test, refresher) {
+  tests::json_doc_generator gen(
+    test_base::resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  irs::memory_directory dir;
+  auto codec_ptr = irs::formats::get("1_3");
+  ASSERT_NE(nullptr, codec_ptr);
+  auto writer = irs::index_writer::make(dir, codec_ptr, irs::OM_CREATE);
+
+  auto insert_next = [&gen, &writer]() {
+    auto* doc = gen.next();
+    return doc && insert(*writer,
+      doc->indexed.begin(), doc->indexed.end(),
+      doc->stored.begin(), doc->stored.end());
+  };
+
+  ASSERT_TRUE(insert_next());
+  writer->commit();
+
+  std::vector<size_t> warmed_up;
+  irs::reader_refresher::options opts;
+  opts.codec = codec_ptr;
+  opts.fields = { "name", "unknown" };
+  opts.warmup = [&warmed_up](const irs::directory_reader& rdr) {
+    warmed_up.emplace_back(rdr.size());
+  };
+
+  irs::reader_refresher refresher(
+    irs::directory_reader::open(dir, codec_ptr), std::move(opts));
+  ASSERT_EQ(1, refresher.reader().size());
+
+  // nothing changed
+  ASSERT_FALSE(refresher.refresh());
+  ASSERT_TRUE(warmed_up.empty());
+
+  // synchronous refresh
+  ASSERT_TRUE(insert_next());
+  writer->commit();
+  auto reader = refresher.reader();
+  ASSERT_TRUE(refresher.refresh());
+  ASSERT_EQ(2, refresher.reader().size());
+  ASSERT_EQ(1, reader.size()); // previously published reader is intact
+  ASSERT_EQ((std::vector<size_t>{ 2 }), warmed_up);
+
+  // background refresh
+  ASSERT_TRUE(insert_next());
+  writer->commit();
+  ASSERT_TRUE(refresher.refresh_async());
+  refresher.wait();
+  ASSERT_EQ(3, refresher.reader().size());
+  ASSERT_EQ((std::vector<size_t>{ 2, 3 }), warmed_up);
+
+  // segments of the published reader are warm
+  auto& segment = refresher.reader()[2];
+  ASSERT_NE(nullptr, segment.column_reader("name"));
+  ASSERT_NE(nullptr, segment.field("name"));
+}
+
 // ----------------------------------------------------------------------------
 // --SECTION--                                                   Segment reader 
 // ----------------------------------------------------------------------------
@@ -432,6 +494,85 @@ TEST(segment_reader_test, open_invalid_segment) {
   }
 }
 
+TEST(segment_reader_test, warmup) {
+  tests::json_doc_generator gen(
+    test_base::resource("simple_sequential.json"),
+    &tests::generic_json_field_factory);
+
+  irs::memory_directory dir;
+  auto codec_ptr = irs::formats::get("1_3");
+  ASSERT_NE(nullptr, codec_ptr);
+  {
+    auto writer = irs::index_writer::make(dir, codec_ptr, irs::OM_CREATE);
+
+    for (const tests::document* doc; (doc = gen.next());) {
+      ASSERT_TRUE(insert(*writer,
+        doc->indexed.begin(), doc->indexed.end(),
+        doc->stored.begin(), doc->stored.end()));
+    }
+    writer->commit();
+  }
+
+  auto index = irs::directory_reader::open(dir, codec_ptr);
+  ASSERT_EQ(1, index.size());
+  auto& meta = index.meta().meta.segment(0).meta;
+
+  // concurrent first access to lazily loaded term index and columns
+  {
+    auto rdr = irs::segment_reader::open(dir, meta);
+    ASSERT_FALSE(!rdr);
+
+    std::vector<std::thread> threads;
+    std::atomic<size_t> succeeded{0};
+    for (size_t i = 0; i < 8; ++i) {
+      threads.emplace_back([&rdr, &succeeded]() {
+        const auto* field = rdr.field("name");
+        const auto* column = rdr.column_reader("name");
+
+        if (!field || !column) {
+          return;
+        }
+
+        auto terms = field->iterator();
+
+        if (irs::SeekResult::FOUND != terms->seek_ge(irs::ref_cast<irs::byte_type>(irs::string_ref("A")))) {
+          return;
+        }
+
+        irs::bytes_ref value;
+        if (!column->values()(irs::doc_limits::min(), value) ||
+            "A" != irs::to_string<irs::string_ref>(value.c_str())) {
+          return;
+        }
+
+        ++succeeded;
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    ASSERT_EQ(threads.size(), succeeded);
+  }
+
+  // explicit warmup, unknown fields are ignored
+  {
+    auto rdr = irs::segment_reader::open(dir, meta);
+    ASSERT_FALSE(!rdr);
+    rdr.warmup({ "name", "seq", "unknown" });
+
+    ASSERT_NE(nullptr, rdr.column("name"));
+    ASSERT_EQ(nullptr, rdr.column("unknown"));
+
+    const auto* field = rdr.field("name");
+    ASSERT_NE(nullptr, field);
+    auto terms = field->iterator();
+    ASSERT_TRUE(terms->next());
+    ASSERT_EQ("A", irs::ref_cast<char>(terms->value()));
+  }
+}
+
 TEST(segment_reader_test, open) {
   tests::json_doc_generator gen(
     test_base::resource("simple_sequential.json"),
@@ -7382,6 +7382,62 @@ TEST_P(phrase_filter_test_case, sequential_several_terms) {
   }
 }
 
+TEST_P(phrase_filter_test_case, rarest_term_not_first) {
+  // "a" is the most frequent term, so a rarer term leads the verification,
+  // leading term may occur before the phrase at the very first position
+  {
+    tests::json_doc_generator gen(
+      "["
+      "{\"name\":\"A\", \"phrase\":\"b a b\"},"
+      "{\"name\":\"B\", \"phrase\":\"a a a\"},"
+      "{\"name\":\"C\", \"phrase\":\"a c\"},"
+      "{\"name\":\"D\", \"phrase\":\"b c a\"},"
+      "{\"name\":\"E\", \"phrase\":\"c b a b x\"},"
+      "{\"name\":\"F\", \"phrase\":\"a\"},"
+      "{\"name\":\"G\", \"phrase\":\"b b x a b\"},"
+      "{\"name\":\"H\", \"phrase\":\"a c a c\"},"
+      "{\"name\":\"I\", \"phrase\":\"x a b x\"},"
+      "{\"name\":\"J\", \"phrase\":\"x a x b\"}"
+      "]",
+      &tests::analyzed_json_field_factory);
+    add_segment(gen);
+  }
+
+  auto rdr = open_reader();
+
+  // "a b", "b" leads
+  {
+    irs::by_phrase q;
+    *q.mutable_field() = "phrase_anl";
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("a"));
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("b"));
+
+    check_query(q, docs_t{ 1, 5, 7, 9 }, rdr);
+  }
+
+  // "a b x", "x" leads
+  {
+    irs::by_phrase q;
+    *q.mutable_field() = "phrase_anl";
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("a"));
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("b"));
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("x"));
+
+    check_query(q, docs_t{ 5, 9 }, rdr);
+  }
+
+  // "a x b", "x" leads from the middle of the phrase
+  {
+    irs::by_phrase q;
+    *q.mutable_field() = "phrase_anl";
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("a"));
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("x"));
+    q.mutable_options()->push_back<irs::by_term_options>().term = irs::ref_cast<irs::byte_type>(irs::string_ref("b"));
+
+    check_query(q, docs_t{ 10 }, rdr);
+  }
+}
+
 TEST(by_phrase_test, options) {
   irs::by_phrase_options opts;
   ASSERT_TRUE(opts.simple());
@@ -772,3 +772,97 @@ TEST_F(directory_utils_tests, test_tracking_dir) {
     ASSERT_EQ(0, files.size());
   }
 }
+
+TEST_F(directory_utils_tests, test_rate_limited_dir) {
+  // test dereference and attributes
+  {
+    irs::memory_directory dir;
+    irs::rate_limited_directory limited_dir(dir, nullptr);
+
+    ASSERT_EQ(&dir, &(*limited_dir));
+    ASSERT_EQ(&(dir.attributes()), &(limited_dir.attributes()));
+    ASSERT_EQ(nullptr, limited_dir.limiter());
+  }
+
+  // test create/open/rename/remove
+  {
+    auto limiter = std::make_shared<irs::rate_limiter>();
+    irs::memory_directory dir;
+    irs::rate_limited_directory limited_dir(dir, limiter);
+    ASSERT_EQ(limiter, limited_dir.limiter());
+
+    auto out = limited_dir.create("abc");
+    ASSERT_FALSE(!out);
+    out->write_byte(42);
+    out->write_int(42);
+    out->write_long(42);
+    out->write_vint(300);
+    out->write_vlong(42);
+    const irs::byte_type bytes[] = { 1, 2, 3 };
+    out->write_bytes(bytes, sizeof bytes);
+    ASSERT_EQ(0, limiter->bytes()); // accounted on flush/close
+    ASSERT_EQ(1 + 4 + 8 + 2 + 1 + 3, out->file_pointer());
+    out->flush();
+    ASSERT_EQ(1 + 4 + 8 + 2 + 1 + 3, limiter->bytes());
+    out.reset();
+    ASSERT_EQ(1 + 4 + 8 + 2 + 1 + 3, limiter->bytes());
+
+    auto in = limited_dir.open("abc", irs::IOAdvice::NORMAL);
+    ASSERT_FALSE(!in);
+    ASSERT_EQ(42, in->read_byte());
+    ASSERT_EQ(42, in->read_int());
+    ASSERT_EQ(42, in->read_long());
+    ASSERT_EQ(300, in->read_vint());
+    ASSERT_EQ(42, in->read_vlong());
+    in.reset();
+
+    ASSERT_TRUE(limited_dir.rename("abc", "def"));
+    bool exists;
+    ASSERT_TRUE(limited_dir.exists(exists, "def") && exists);
+    ASSERT_TRUE(limited_dir.remove("def"));
+    ASSERT_TRUE(dir.exists(exists, "def") && !exists);
+  }
+
+  // test pacing
+  {
+    constexpr size_t SIZE = 256*1024;
+    constexpr uint64_t RATE = 1024*1024;
+
+    auto limiter = std::make_shared<irs::rate_limiter>(RATE);
+    irs::memory_directory dir;
+    irs::rate_limited_directory limited_dir(dir, limiter);
+    const std::vector<irs::byte_type> bytes(1024, 42);
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+      auto out = limited_dir.create("abc");
+      ASSERT_FALSE(!out);
+
+      for (size_t i = 0; i < SIZE / bytes.size(); ++i) {
+        out->write_bytes(bytes.data(), bytes.size());
+      }
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(SIZE, limiter->bytes());
+    // 256KiB at 1MiB/s, leave some slack for timer granularity
+    ASSERT_LE(std::chrono::milliseconds(200), elapsed);
+    ASSERT_LT(std::chrono::nanoseconds(0), limiter->paused());
+    ASSERT_GE(1.25*RATE, limiter->throughput());
+
+    // lift the budget
+    limiter->bytes_per_sec(0);
+    ASSERT_EQ(0, limiter->bytes_per_sec());
+    const auto paused = limiter->paused();
+    {
+      auto out = limited_dir.create("def");
+      ASSERT_FALSE(!out);
+
+      for (size_t i = 0; i < SIZE / bytes.size(); ++i) {
+        out->write_bytes(bytes.data(), bytes.size());
+      }
+    }
+    ASSERT_EQ(2*SIZE, limiter->bytes());
+    ASSERT_EQ(paused, limiter->paused());
+  }
+}
@@ -28,6 +28,10 @@
 #include "store/store_utils.hpp"
 #include "utils/crc.hpp"
 #include "utils/encryption.hpp"
+#include "utils/ctr_encryption.hpp"
+#include "utils/timer_utils.hpp"
+
+#include <fstream>
 
 NS_LOCAL
 
@@ -170,6 +174,167 @@ void assert_encryption(size_t block_size, size_t header_lenght) {
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// @class mix_cipher
+/// @brief cipher mixing each byte with its position in a block, optionally
+///        overrides batch processing of blocks
+////////////////////////////////////////////////////////////////////////////////
+class mix_cipher final : public irs::cipher {
+ public:
+  mix_cipher(size_t block_size, bool batch) noexcept
+    : block_size_(block_size), batch_(batch) {
+  }
+
+  virtual size_t block_size() const noexcept override {
+    return block_size_;
+  }
+
+  virtual bool encrypt(irs::byte_type* data) const override {
+    ++block_calls;
+    encrypt_block(data);
+    return true;
+  }
+
+  virtual bool decrypt(irs::byte_type* data) const override {
+    ++block_calls;
+    for (size_t i = 0; i < block_size_; ++i) {
+      data[i] = irs::byte_type(data[i] - 7*i) ^ 0x5A;
+    }
+    return true;
+  }
+
+  virtual bool encrypt_blocks(irs::byte_type* data, size_t count) const override {
+    if (!batch_) {
+      return irs::cipher::encrypt_blocks(data, count);
+    }
+
+    ++batch_calls;
+    for (; count; --count, data += block_size_) {
+      encrypt_block(data);
+    }
+    return true;
+  }
+
+  mutable size_t block_calls{};
+  mutable size_t batch_calls{};
+
+ private:
+  void encrypt_block(irs::byte_type* data) const noexcept {
+    for (size_t i = 0; i < block_size_; ++i) {
+      data[i] = irs::byte_type((data[i] ^ 0x5A) + 7*i);
+    }
+  }
+
+  size_t block_size_;
+  bool batch_;
+}; // mix_cipher
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief block at a time CTR transformation, i.e. the way the keystream is
+///        expected to be laid out on disk
+////////////////////////////////////////////////////////////////////////////////
+bool ctr_encrypt_block_by_block(
+    const irs::cipher& cipher,
+    const irs::bytes_ref& header,
+    uint64_t offset,
+    irs::byte_type* data,
+    size_t size) {
+  const auto block_size = cipher.block_size();
+  const auto* begin = header.c_str();
+  const uint64_t counter_base = irs::read<uint64_t>(begin);
+  const irs::bytes_ref iv(header.c_str() + block_size, block_size);
+
+  uint64_t block_index = offset / block_size;
+  size_t block_offset = offset % block_size;
+  bstring scratch(std::max(block_size, sizeof(uint64_t)), 0);
+
+  while (size) {
+    std::memcpy(&scratch[0], iv.c_str(), block_size);
+    auto* out = &scratch[0];
+    irs::write<uint64_t>(out, counter_base + block_index);
+
+    if (!cipher.encrypt(&scratch[0])) {
+      return false;
+    }
+
+    const size_t n = std::min(size, block_size - block_offset);
+    for (size_t i = 0; i < n; ++i) {
+      data[i] ^= scratch[block_offset + i];
+    }
+
+    data += n;
+    size -= n;
+    block_offset = 0;
+    ++block_index;
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief CTR transformation the way 'ctr_cipher_stream' used to do it before
+///        batching, i.e. allocating a block buffer and a scratch buffer on
+///        every call and copying partial blocks through the block buffer,
+///        used as a baseline for profiling
+////////////////////////////////////////////////////////////////////////////////
+bool ctr_encrypt_allocating(
+    const irs::cipher& cipher,
+    const irs::bytes_ref& header,
+    uint64_t offset,
+    irs::byte_type* data,
+    size_t size) {
+  const auto block_size = cipher.block_size();
+  const auto* begin = header.c_str();
+  const uint64_t counter_base = irs::read<uint64_t>(begin);
+  const irs::bytes_ref iv(header.c_str() + block_size, block_size);
+
+  uint64_t block_index = offset / block_size;
+  size_t block_offset = offset % block_size;
+
+  bstring block_buf;
+  bstring scratch(block_size, 0);
+
+  while (true) {
+    irs::byte_type* block = data;
+    const size_t n = std::min(size, block_size - block_offset);
+
+    if (n != block_size) {
+      block_buf.resize(block_size);
+      block = &block_buf[0];
+      std::memmove(block + block_offset, data, n);
+    }
+
+    // init nonce + counter
+    std::memmove(&scratch[0], iv.c_str(), block_size);
+    auto* out = &scratch[0];
+    irs::write<uint64_t>(out, counter_base + block_index);
+
+    if (!cipher.encrypt(&scratch[0])) {
+      return false;
+    }
+
+    for (size_t i = 0; i < block_size; ++i) {
+      block[i] ^= scratch[i];
+    }
+
+    if (block != data) {
+      std::memmove(data, block + block_offset, n);
+    }
+
+    size -= n;
+
+    if (!size) {
+      return true;
+    }
+
+    data += n;
+    block_offset = 0;
+    ++block_index;
+  }
+}
+
+class ctr_cipher_stream_test: public test_base { };
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                          ctr_encryption_test_case
 // -----------------------------------------------------------------------------
@@ -217,6 +382,95 @@ TEST(ctr_encryption_test, create_header_stream) {
   }
 }
 
+TEST_F(ctr_cipher_stream_test, batch_keystream) {
+  bstring data(10000, 0);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = irs::byte_type(i * 31);
+  }
+
+  // 2000 > ctr stream on-stack keystream buffer
+  for (const size_t block_size : { 1, 7, 13, 16, 2000 }) {
+    mix_cipher batch_cipher(block_size, true);
+    mix_cipher block_cipher(block_size, false);
+    irs::ctr_encryption batch_enc(batch_cipher);
+    irs::ctr_encryption block_enc(block_cipher);
+
+    bstring header(batch_enc.header_length(), 0);
+    ASSERT_TRUE(batch_enc.create_header("encrypted", &header[0]));
+    bstring block_header = header;
+    auto batch_stream = batch_enc.create_stream("encrypted", &header[0]);
+    ASSERT_NE(nullptr, batch_stream);
+    auto block_stream = block_enc.create_stream("encrypted", &block_header[0]);
+    ASSERT_NE(nullptr, block_stream);
+    ASSERT_EQ(header, block_header);
+
+    for (const size_t offset : { 0, 1, 4, 1023, 4096, 7777 }) {
+      for (const size_t size : { 1, 13, 1024, 5000, 10000 }) {
+        bstring expected(data.c_str(), size);
+        ASSERT_TRUE(ctr_encrypt_block_by_block(
+          block_cipher, header, offset, &expected[0], expected.size()));
+        ASSERT_NE(irs::bytes_ref(data.c_str(), size), irs::bytes_ref(expected));
+
+        bstring actual(data.c_str(), size);
+        batch_cipher.batch_calls = 0;
+        ASSERT_TRUE(batch_stream->encrypt(offset, &actual[0], actual.size()));
+        ASSERT_EQ(expected, actual);
+        ASSERT_LT(0, batch_cipher.batch_calls);
+        ASSERT_TRUE(batch_stream->decrypt(offset, &actual[0], actual.size()));
+        ASSERT_EQ(irs::bytes_ref(data.c_str(), size), irs::bytes_ref(actual));
+
+        // default 'encrypt_blocks' falls back to block by block encryption
+        actual.assign(data.c_str(), size);
+        ASSERT_TRUE(block_stream->encrypt(offset, &actual[0], actual.size()));
+        ASSERT_EQ(expected, actual);
+      }
+    }
+
+    ASSERT_EQ(0, batch_cipher.block_calls);
+  }
+}
+
+TEST_F(ctr_cipher_stream_test, profile_encrypt) {
+  const size_t block_size = 16;
+  const size_t chunk_size = 4096; // size of the typical buffered I/O request
+  const size_t chunks = 4096;
+
+  mix_cipher cipher(block_size, true);
+  irs::ctr_encryption enc(cipher);
+  bstring header(enc.header_length(), 0);
+  ASSERT_TRUE(enc.create_header("encrypted", &header[0]));
+  const bstring plain_header = header;
+  auto stream = enc.create_stream("encrypted", &header[0]);
+  ASSERT_NE(nullptr, stream);
+
+  bstring expected(chunk_size*chunks, 0);
+  bstring actual = expected;
+
+  irs::timer_utils::init_stats(true);
+
+  // the previous implementation: per call allocations, one block at a time
+  for (size_t i = 0; i < chunks; ++i) {
+    SCOPED_TIMER("ctr allocating block by block (previous)");
+    ASSERT_TRUE(ctr_encrypt_allocating(
+      cipher, plain_header, i*chunk_size, &expected[i*chunk_size], chunk_size));
+  }
+
+  for (size_t i = 0; i < chunks; ++i) {
+    SCOPED_TIMER("ctr batch");
+    ASSERT_TRUE(stream->encrypt(i*chunk_size, &actual[i*chunk_size], chunk_size));
+  }
+
+  ASSERT_EQ(expected, actual);
+
+  auto path = test_dir();
+  path /= "profile_ctr_encryption.log";
+
+  std::ofstream out(path.native());
+  irs::timer_utils::flush_stats(out);
+  out.close();
+  std::cout << "Path to timing log: " << path.utf8_absolute() << std::endl;
+}
+
 // -----------------------------------------------------------------------------
 // --SECTION--                                              encryption_test_case
 // -----------------------------------------------------------------------------
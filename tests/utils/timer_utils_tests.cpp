@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#include "gtest/gtest.h"
+#include "utils/timer_utils.hpp"
+
+#include <sstream>
+#include <thread>
+
+NS_LOCAL
+
+using irs::timer_utils::metric;
+
+std::pair<uint64_t, uint64_t> get_metric(metric expected) {
+  std::pair<uint64_t, uint64_t> value{};
+
+  irs::timer_utils::visit_metrics(
+      [expected, &value](metric id, uint64_t count, uint64_t time_ns) {
+    if (id == expected) {
+      value = { count, time_ns };
+      return false;
+    }
+    return true;
+  });
+
+  return value;
+}
+
+NS_END
+
+TEST(timer_utils_test, metric_name) {
+  ASSERT_EQ("postings_block_decode", irs::timer_utils::metric_name(metric::POSTINGS_BLOCK_DECODE));
+  ASSERT_EQ("column_block_load", irs::timer_utils::metric_name(metric::COLUMN_BLOCK_LOAD));
+  ASSERT_EQ("term_seek", irs::timer_utils::metric_name(metric::TERM_SEEK));
+  ASSERT_EQ("segment_flush", irs::timer_utils::metric_name(metric::SEGMENT_FLUSH));
+  ASSERT_EQ("segment_merge", irs::timer_utils::metric_name(metric::SEGMENT_MERGE));
+  ASSERT_TRUE(irs::timer_utils::metric_name(metric::COUNT).null());
+}
+
+TEST(timer_utils_test, metrics) {
+  irs::timer_utils::reset_metrics();
+  ASSERT_EQ(0, get_metric(metric::TERM_SEEK).first);
+
+  // current thread
+  irs::timer_utils::count(metric::TERM_SEEK);
+  irs::timer_utils::count(metric::TERM_SEEK, 2);
+  ASSERT_EQ(3, get_metric(metric::TERM_SEEK).first);
+  ASSERT_EQ(0, get_metric(metric::TERM_SEEK).second);
+
+  // shard is registered once and then accessed inline
+  ASSERT_NE(nullptr, irs::timer_utils::local_metrics_shard);
+  ASSERT_EQ(irs::timer_utils::local_metrics_shard, &irs::timer_utils::local_metrics());
+  ASSERT_EQ(irs::timer_utils::local_metrics_shard, &irs::timer_utils::register_local_metrics());
+
+  // values of finished threads are retained
+  {
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+      threads.emplace_back([]() {
+        for (size_t j = 0; j < 1000; ++j) {
+          irs::timer_utils::count(metric::TERM_SEEK);
+        }
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  ASSERT_EQ(4003, get_metric(metric::TERM_SEEK).first);
+
+  // timed events
+  {
+    irs::timer_utils::scoped_metric timer(metric::SEGMENT_MERGE);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  auto merge = get_metric(metric::SEGMENT_MERGE);
+  ASSERT_EQ(1, merge.first);
+  ASSERT_LE(1000000, merge.second);
+
+  std::stringstream out;
+  irs::timer_utils::flush_metrics(out);
+  ASSERT_NE(std::string::npos, out.str().find("term_seek\tcount:4003"));
+  ASSERT_NE(std::string::npos, out.str().find("segment_merge\tcount:1,"));
+
+  irs::timer_utils::reset_metrics();
+  ASSERT_EQ(0, get_metric(metric::TERM_SEEK).first);
+  ASSERT_EQ(0, get_metric(metric::SEGMENT_MERGE).first);
+  ASSERT_EQ(0, get_metric(metric::SEGMENT_MERGE).second);
+  irs::timer_utils::count(metric::TERM_SEEK);
+  ASSERT_EQ(1, get_metric(metric::TERM_SEEK).first);
+}
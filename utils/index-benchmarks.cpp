@@ -22,6 +22,7 @@
 /// @author Vasiliy Nabatchikov
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "index-micro.hpp"
 #include "index-put.hpp"
 #include "index-search.hpp"
 
@@ -35,9 +36,11 @@ typedef std::unordered_map<
 
 const std::string MODE_PUT = "put";
 const std::string MODE_SEARCH = "search";
+const std::string MODE_MICRO = "micro";
 
 bool init_handlers(handlers_t& handlers) {
   handlers.emplace(MODE_PUT, &put);
   handlers.emplace(MODE_SEARCH, &search);
+  handlers.emplace(MODE_MICRO, &micro);
   return true;
 }
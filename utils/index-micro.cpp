@@ -0,0 +1,668 @@
+////////////////////////////////////////////////////////////////////////////////
+/// DISCLAIMER
+///
+/// Copyright 2020 ArangoDB GmbH, Cologne, Germany
+///
+/// Licensed under the Apache License, Version 2.0 (the "License");
+/// you may not use this file except in compliance with the License.
+/// You may obtain a copy of the License at
+///
+///     http://www.apache.org/licenses/LICENSE-2.0
+///
+/// Unless required by applicable law or agreed to in writing, software
+/// distributed under the License is distributed on an "AS IS" BASIS,
+/// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+/// See the License for the specific language governing permissions and
+/// limitations under the License.
+///
+/// Copyright holder is ArangoDB GmbH, Cologne, Germany
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined(_MSC_VER)
+  #pragma warning(disable: 4101)
+  #pragma warning(disable: 4267)
+#endif
+
+  #include <cmdline.h>
+
+#if defined(_MSC_VER)
+  #pragma warning(default: 4267)
+  #pragma warning(default: 4101)
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <tuple>
+
+#include "analysis/pre_analyzed_token_stream.hpp"
+#include "analysis/token_streams.hpp"
+#include "index/directory_reader.hpp"
+#include "index/index_writer.hpp"
+#include "search/bitset_doc_iterator.hpp"
+#include "search/conjunction.hpp"
+#include "search/disjunction.hpp"
+#include "search/score.hpp"
+#include "search/scorers.hpp"
+#include "search/term_filter.hpp"
+#include "store/memory_directory.hpp"
+#include "store/store_utils.hpp"
+#include "utils/bit_packing.hpp"
+#include "utils/bitset.hpp"
+#include "utils/bytes_utils.hpp"
+#include "utils/index_utils.hpp"
+#include "utils/lz4compression.hpp"
+#include "utils/text_format.hpp"
+
+#ifdef IRESEARCH_SSE2
+#include "store/store_utils_simd.hpp"
+#endif
+
+#include "index-micro.hpp"
+
+NS_LOCAL
+
+const std::string HELP = "help";
+const std::string FILTER = "filter";
+const std::string LIST = "list";
+const std::string MIN_TIME = "min-time-ms";
+const std::string REPETITIONS = "repetitions";
+const std::string SEED = "seed";
+const std::string FORMAT = "format";
+const std::string DOCS = "docs";
+const std::string CSV = "csv";
+
+// results of the kernels are accumulated here, so that the compiler
+// is not able to throw the measured code away
+volatile uint64_t sink;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief a single measured kernel, 'run' executes one iteration and returns
+///        the number of items it processed (values, bytes, documents, ...)
+////////////////////////////////////////////////////////////////////////////////
+struct benchmark {
+  std::string name;
+  std::function<size_t()> run;
+};
+
+typedef std::vector<benchmark> benchmarks_t;
+
+// 16 byte alignment is required by the SIMD block codecs
+template<size_t Size>
+struct alignas(16) block_buffer {
+  uint32_t data[Size];
+};
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                            bit packing & codecs
+// -----------------------------------------------------------------------------
+
+void add_bit_packing(benchmarks_t& benchmarks, std::mt19937& rnd) {
+  constexpr uint32_t SIZE = irs::packed::BLOCK_SIZE_32;
+
+  struct state {
+    block_buffer<SIZE> decoded;
+    block_buffer<SIZE> encoded;
+    block_buffer<SIZE> out;
+  };
+
+  for (const uint32_t bits : { 1U, 7U, 13U, 21U, 32U }) {
+    auto s = std::make_shared<state>();
+    std::uniform_int_distribution<uint32_t> dist(
+      0, irs::packed::max_value<uint32_t>(bits));
+    std::generate(std::begin(s->decoded.data), std::end(s->decoded.data),
+                  [&](){ return dist(rnd); });
+    irs::packed::pack_block(s->decoded.data, s->encoded.data, bits);
+
+    benchmarks.push_back({
+      "packed/pack_block/" + std::to_string(bits),
+      [s, bits]() {
+        irs::packed::pack_block(s->decoded.data, s->out.data, bits);
+        sink += s->out.data[0];
+        return size_t(SIZE);
+    }});
+
+    benchmarks.push_back({
+      "packed/unpack_block/" + std::to_string(bits),
+      [s, bits]() {
+        irs::packed::unpack_block(s->encoded.data, s->out.data, bits);
+        sink += s->out.data[SIZE - 1];
+        return size_t(SIZE);
+    }});
+  }
+}
+
+void add_block_codecs(benchmarks_t& benchmarks, std::mt19937& rnd) {
+  constexpr uint32_t SIZE = 128; // block size of 'encode::bitpack' codecs
+
+  struct state {
+    block_buffer<SIZE> decoded;
+    block_buffer<SIZE> encoded;
+    block_buffer<SIZE> out;
+    irs::bstring data;
+    irs::bstring buf;
+  };
+
+  typedef uint32_t(*write_f)(irs::data_output&, const uint32_t*, uint32_t*);
+  typedef void(*read_f)(irs::data_input&, uint32_t*, uint32_t*);
+
+  const std::vector<std::tuple<std::string, write_f, read_f>> codecs {
+    { "bitpack", &irs::encode::bitpack::write_block, &irs::encode::bitpack::read_block },
+#ifdef IRESEARCH_SSE2
+    { "bitpack_simd", &irs::encode::bitpack::write_block_simd, &irs::encode::bitpack::read_block_simd },
+#endif
+  };
+
+  for (const uint32_t bits : { 3U, 11U, 24U }) {
+    auto s = std::make_shared<state>();
+    std::uniform_int_distribution<uint32_t> dist(
+      0, irs::packed::max_value<uint32_t>(bits));
+    std::generate(std::begin(s->decoded.data), std::end(s->decoded.data),
+                  [&](){ return dist(rnd); });
+
+    for (auto& codec : codecs) {
+      const auto write = std::get<1>(codec);
+      const auto read = std::get<2>(codec);
+      const auto suffix = std::get<0>(codec) + "/" + std::to_string(bits);
+
+      benchmarks.push_back({
+        "encode/write_block/" + suffix,
+        [s, write]() {
+          s->buf.clear();
+          irs::bytes_output out(s->buf);
+          sink += write(out, s->decoded.data, s->encoded.data);
+          return size_t(SIZE);
+      }});
+
+      benchmarks.push_back({
+        "encode/read_block/" + suffix,
+        [s, write, read]() {
+          if (s->data.empty()) {
+            irs::bytes_output out(s->data);
+            write(out, s->decoded.data, s->encoded.data);
+          }
+
+          irs::bytes_ref_input in(s->data);
+          read(in, s->encoded.data, s->out.data);
+          sink += s->out.data[SIZE - 1];
+          return size_t(SIZE);
+      }});
+    }
+  }
+}
+
+void add_vint(benchmarks_t& benchmarks, std::mt19937& rnd) {
+  constexpr size_t COUNT = 4096;
+
+  // values of all encoded lengths (1-5 bytes) in roughly equal shares
+  auto data = std::make_shared<irs::bstring>();
+  {
+    irs::bytes_output out(*data);
+    for (size_t i = 0; i < COUNT; ++i) {
+      out.write_vint(uint32_t(rnd()) >> (7 * (rnd() % 5)));
+    }
+  }
+
+  benchmarks.push_back({
+    "vint/read_vint",
+    [data]() {
+      irs::bytes_ref_input in(*data);
+      uint64_t sum = 0;
+      for (size_t i = 0; i < COUNT; ++i) {
+        sum += in.read_vint();
+      }
+      sink += sum;
+      return COUNT;
+  }});
+}
+
+void add_lz4(benchmarks_t& benchmarks, std::mt19937& rnd) {
+  constexpr size_t SIZE = 1 << 16;
+
+  struct state {
+    irs::bstring text;
+    irs::bstring compressed;
+    irs::bstring buf;
+    irs::bstring out;
+    irs::compression::lz4::lz4compressor compressor;
+    irs::compression::lz4::lz4decompressor decompressor;
+  };
+
+  auto s = std::make_shared<state>();
+
+  // text-like data: words of a small vocabulary separated by spaces
+  std::vector<std::string> vocabulary(1024);
+  std::uniform_int_distribution<size_t> length(3, 10);
+  std::uniform_int_distribution<int> letter('a', 'z');
+  for (auto& word : vocabulary) {
+    word.resize(length(rnd));
+    std::generate(word.begin(), word.end(), [&](){ return char(letter(rnd)); });
+  }
+
+  std::uniform_int_distribution<size_t> word(0, vocabulary.size() - 1);
+  while (s->text.size() < SIZE) {
+    const auto& w = vocabulary[word(rnd)];
+    s->text.append(reinterpret_cast<const irs::byte_type*>(w.c_str()), w.size());
+    s->text.push_back(irs::byte_type(' '));
+  }
+  s->text.resize(SIZE);
+
+  const auto compressed = s->compressor.compress(&s->text[0], SIZE, s->buf);
+  s->compressed.assign(compressed.c_str(), compressed.size());
+  s->out.resize(SIZE);
+
+  benchmarks.push_back({
+    "lz4/compress",
+    [s]() {
+      sink += s->compressor.compress(&s->text[0], SIZE, s->buf).size();
+      return SIZE;
+  }});
+
+  benchmarks.push_back({
+    "lz4/decompress",
+    [s]() {
+      sink += s->decompressor.decompress(
+        s->compressed.c_str(), s->compressed.size(), &s->out[0], SIZE).size();
+      return SIZE;
+  }});
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                          disjunction/conjunction
+// -----------------------------------------------------------------------------
+
+void add_doc_iterators(benchmarks_t& benchmarks, std::mt19937& rnd) {
+  typedef irs::disjunction<irs::doc_iterator::ptr> disjunction_t;
+  typedef irs::conjunction<irs::doc_iterator::ptr> conjunction_t;
+
+  constexpr size_t DOCS = 1 << 20;
+
+  // posting lists of different densities
+  auto sets = std::make_shared<std::vector<irs::bitset>>();
+  for (size_t i = 0; i < 32; ++i) {
+    const double density = 1. / (2 << (i % 8)); // 1/2 ... 1/256
+    std::bernoulli_distribution dist(density);
+    irs::bitset set(DOCS);
+    for (size_t doc = irs::doc_limits::min(); doc < DOCS; ++doc) {
+      if (dist(rnd)) {
+        set.set(doc);
+      }
+    }
+    sets->emplace_back(std::move(set));
+  }
+
+  auto iterate = [](irs::doc_iterator::ptr&& it) {
+    size_t count = 0;
+    while (it->next()) {
+      ++count;
+    }
+    sink += count;
+    return count;
+  };
+
+  for (const size_t count : { 2, 4, 8, 32 }) {
+    benchmarks.push_back({
+      "disjunction/" + std::to_string(count),
+      [sets, count, iterate]() {
+        disjunction_t::doc_iterators_t itrs;
+        itrs.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+          itrs.emplace_back(
+            irs::doc_iterator::make<irs::bitset_doc_iterator>((*sets)[i]));
+        }
+        return iterate(irs::make_disjunction<disjunction_t>(
+          std::move(itrs), irs::order::prepared::unordered()));
+    }});
+
+    benchmarks.push_back({
+      "conjunction/" + std::to_string(count),
+      [sets, count, iterate]() {
+        conjunction_t::doc_iterators_t itrs;
+        itrs.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+          itrs.emplace_back(
+            irs::doc_iterator::make<irs::bitset_doc_iterator>((*sets)[i]));
+        }
+        return iterate(irs::make_conjunction<conjunction_t>(
+          std::move(itrs), irs::order::prepared::unordered()));
+    }});
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                               term lookup & bm25
+// -----------------------------------------------------------------------------
+
+struct field {
+  field(const std::string& name, const irs::flags& features)
+    : name_(name), features_(features) {
+  }
+
+  irs::string_ref name() const { return name_; }
+  const irs::flags& features() const { return features_; }
+  float_t boost() const { return 1.f; }
+
+  std::string name_;
+  irs::flags features_;
+};
+
+struct id_field : field {
+  using field::field;
+
+  irs::token_stream& get_tokens() const {
+    stream.reset(value);
+    return stream;
+  }
+
+  std::string value;
+  mutable irs::string_token_stream stream;
+};
+
+struct body_field : field {
+  using field::field;
+
+  irs::token_stream& get_tokens() const {
+    stream.reset(value);
+    return stream;
+  }
+
+  irs::bstring value; // in 'pre_analyzed_token_stream' format
+  mutable irs::pre_analyzed_token_stream stream;
+};
+
+std::string make_id(size_t i) {
+  char buf[16];
+  snprintf(buf, sizeof buf, "id%08zu", i);
+  return buf;
+}
+
+void add_index(
+    benchmarks_t& benchmarks,
+    std::mt19937& rnd,
+    const std::string& format,
+    size_t docs_count) {
+  constexpr size_t WORDS_PER_DOC = 32;
+  constexpr size_t QUERIES = 1024;
+
+  struct state {
+    irs::memory_directory dir;
+    irs::directory_reader reader;
+    std::vector<std::string> vocabulary;
+    std::vector<std::string> ids; // existing and missing ids, shuffled
+  };
+
+  auto codec = irs::formats::get(format);
+
+  if (!codec) {
+    std::cerr << "Unable to load format '" << format << "'" << std::endl;
+    return;
+  }
+
+  auto s = std::make_shared<state>();
+
+  s->vocabulary.reserve(1 << 14);
+  for (size_t i = 0; i < (1 << 14); ++i) {
+    s->vocabulary.emplace_back("w" + std::to_string(i));
+  }
+
+  // populate a single segment index, words are picked with a roughly zipfian
+  // distribution so that queries hit both long and short posting lists
+  {
+    auto writer = irs::index_writer::make(s->dir, codec, irs::OM_CREATE);
+    id_field id("id", irs::flags::empty_instance());
+    body_field body("body", irs::flags{
+      irs::type<irs::frequency>::get(), irs::type<irs::norm>::get() });
+    std::uniform_real_distribution<double> dist(
+      0., std::log(double(s->vocabulary.size())));
+
+    {
+      auto ctx = writer->documents();
+
+      for (size_t i = 0; i < docs_count; ++i) {
+        id.value = make_id(i);
+
+        body.value.clear();
+        auto out = std::back_inserter(body.value);
+        *out = irs::pre_analyzed_token_stream::FORMAT_VERSION;
+        *out = irs::pre_analyzed_token_stream::NONE;
+        for (size_t j = 0; j < WORDS_PER_DOC; ++j) {
+          const auto& word = s->vocabulary[size_t(std::exp(dist(rnd))) - 1];
+          irs::vwrite(out, uint32_t(word.size()));
+          std::copy(word.begin(), word.end(), out);
+          irs::vwrite(out, uint32_t(1));
+        }
+
+        auto doc = ctx.insert();
+        doc.insert<irs::Action::INDEX>(id);
+        doc.insert<irs::Action::INDEX>(body);
+      }
+    }
+
+    writer->commit();
+    writer->consolidate(irs::index_utils::consolidation_policy(
+      irs::index_utils::consolidate_count()));
+    writer->commit();
+  }
+
+  s->reader = irs::directory_reader::open(s->dir, codec);
+
+  // half of the looked up ids doesn't exist
+  std::uniform_int_distribution<size_t> id_dist(0, 2 * docs_count);
+  for (size_t i = 0; i < QUERIES; ++i) {
+    s->ids.emplace_back(make_id(id_dist(rnd)));
+  }
+
+  benchmarks.push_back({
+    "terms/seek",
+    [s]() {
+      size_t found = 0;
+      for (auto& segment : s->reader) {
+        auto* terms = segment.field("id");
+        if (!terms) {
+          continue;
+        }
+
+        auto it = terms->iterator();
+        for (auto& id : s->ids) {
+          found += size_t(it->seek(irs::ref_cast<irs::byte_type>(irs::string_ref(id))));
+        }
+      }
+      sink += found;
+      return s->ids.size();
+  }});
+
+  auto scorer = irs::scorers::get(
+    "bm25", irs::type<irs::text_format::json>::get(), irs::string_ref::NIL);
+
+  if (!scorer) {
+    std::cerr << "Unable to load scorer 'bm25'" << std::endl;
+    return;
+  }
+
+  irs::order sort;
+  sort.add(true, scorer);
+  auto order = std::make_shared<irs::order::prepared>(sort.prepare());
+
+  // frequent, average and rare terms
+  for (const size_t rank : { 0, 16, 1024 }) {
+    irs::by_term query;
+    *query.mutable_field() = "body";
+    query.mutable_options()->term = irs::ref_cast<irs::byte_type>(
+      irs::string_ref(s->vocabulary[rank]));
+    std::shared_ptr<const irs::filter::prepared> prepared =
+      query.prepare(s->reader, *order);
+
+    benchmarks.push_back({
+      "bm25/term/" + std::to_string(rank),
+      [s, order, prepared]() {
+        size_t count = 0;
+        float_t sum = 0.f;
+        for (auto& segment : s->reader) {
+          auto docs = prepared->execute(segment, *order);
+          const irs::score& score = irs::score::get(*docs);
+
+          while (docs->next()) {
+            score.evaluate();
+            sum += order->get<float_t>(score.c_str(), 0);
+            ++count;
+          }
+        }
+        sink += uint64_t(sum);
+        return count;
+    }});
+  }
+}
+
+// -----------------------------------------------------------------------------
+// --SECTION--                                                           runner
+// -----------------------------------------------------------------------------
+
+struct result {
+  size_t iterations;
+  double min_ns; // per iteration
+  double median_ns; // per iteration
+  double items_per_sec;
+};
+
+// @returns nanoseconds spent in 'iterations' calls of the specified benchmark
+double measure(const benchmark& b, size_t iterations, size_t& items) {
+  items = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    items += b.run();
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+}
+
+result run(const benchmark& b, double min_time_ns, size_t repetitions) {
+  size_t items;
+  measure(b, 1, items); // warm up caches and lazily initialized state
+
+  // grow the number of iterations until a single repetition lasts long enough
+  size_t iterations = 1;
+  for (double ns; (ns = measure(b, iterations, items)) < min_time_ns; ) {
+    const double factor = ns > 0 ? 1.4 * min_time_ns / ns : 10.;
+    iterations = std::max(iterations + 1, size_t(iterations * std::min(factor, 10.)));
+  }
+
+  std::vector<double> samples;
+  samples.reserve(repetitions);
+  for (size_t i = 0; i < repetitions; ++i) {
+    samples.emplace_back(measure(b, iterations, items) / iterations);
+  }
+  std::sort(samples.begin(), samples.end());
+
+  result r;
+  r.iterations = iterations;
+  r.min_ns = samples.front();
+  r.median_ns = samples[samples.size() / 2];
+  r.items_per_sec = r.median_ns > 0
+    ? 1e9 * (double(items) / iterations) / r.median_ns
+    : 0.;
+
+  return r;
+}
+
+int micro(const cmdline::parser& args) {
+  const auto filter = args.get<std::string>(FILTER);
+  const auto min_time_ns = 1e6 * double(std::max(size_t(1), args.get<size_t>(MIN_TIME)));
+  const auto repetitions = std::max(size_t(1), args.get<size_t>(REPETITIONS));
+  const bool csv = args.exist(CSV);
+  std::mt19937 rnd(args.get<uint32_t>(SEED));
+
+  auto matches = [&filter](const std::string& name) {
+    return filter.empty() || name.find(filter) != std::string::npos;
+  };
+
+  benchmarks_t benchmarks;
+  add_bit_packing(benchmarks, rnd);
+  add_block_codecs(benchmarks, rnd);
+  add_vint(benchmarks, rnd);
+  add_lz4(benchmarks, rnd);
+  add_doc_iterators(benchmarks, rnd);
+
+  // building the index dominates the startup, skip it if not needed
+  const auto index_benchmarks = {
+    "terms/seek", "bm25/term/0", "bm25/term/16", "bm25/term/1024"
+  };
+
+  if (args.exist(LIST)
+      || std::any_of(index_benchmarks.begin(), index_benchmarks.end(), matches)) {
+    add_index(benchmarks, rnd, args.get<std::string>(FORMAT), args.get<size_t>(DOCS));
+  }
+
+  if (args.exist(LIST)) {
+    for (auto& b : benchmarks) {
+      std::cout << b.name << std::endl;
+    }
+    return 0;
+  }
+
+  if (csv) {
+    std::cout << "Benchmark,Iterations,MedianNs,MinNs,ItemsPerSec" << std::endl;
+  } else {
+    std::cout << std::left << std::setw(36) << "Benchmark"
+              << std::right << std::setw(12) << "Iterations"
+              << std::setw(16) << "Median(ns)"
+              << std::setw(16) << "Min(ns)"
+              << std::setw(16) << "Items/s" << std::endl;
+  }
+
+  for (auto& b : benchmarks) {
+    if (!matches(b.name)) {
+      continue;
+    }
+
+    const auto r = run(b, min_time_ns, repetitions);
+
+    if (csv) {
+      std::cout << b.name << "," << r.iterations << ","
+                << std::fixed << std::setprecision(1)
+                << r.median_ns << "," << r.min_ns << ","
+                << std::setprecision(0) << r.items_per_sec << std::endl;
+    } else {
+      std::cout << std::left << std::setw(36) << b.name
+                << std::right << std::setw(12) << r.iterations
+                << std::fixed << std::setprecision(1)
+                << std::setw(16) << r.median_ns
+                << std::setw(16) << r.min_ns
+                << std::setprecision(0)
+                << std::setw(16) << r.items_per_sec << std::endl;
+    }
+  }
+
+  return 0;
+}
+
+NS_END
+
+int micro(int argc, char* argv[]) {
+  // mode micro
+  cmdline::parser cmdmicro;
+  cmdmicro.add(HELP, '?', "Produce help message");
+  cmdmicro.add<std::string>(FILTER, 0, "Run only benchmarks containing the specified substring", false, std::string());
+  cmdmicro.add(LIST, 0, "List available benchmarks");
+  cmdmicro.add<size_t>(MIN_TIME, 0, "Minimal duration of a single repetition in milliseconds", false, size_t(500));
+  cmdmicro.add<size_t>(REPETITIONS, 0, "Number of measured repetitions", false, size_t(5));
+  cmdmicro.add<uint32_t>(SEED, 0, "Seed of the synthetic input generator", false, uint32_t(42));
+  cmdmicro.add<std::string>(FORMAT, 0, "Format of the in-memory index", false, std::string("1_0"));
+  cmdmicro.add<size_t>(DOCS, 0, "Number of documents in the in-memory index", false, size_t(100000));
+  cmdmicro.add(CSV, 0, "CSV output");
+
+  cmdmicro.parse(argc, argv);
+
+  if (cmdmicro.exist(HELP)) {
+    std::cout << cmdmicro.usage() << std::endl;
+    return 0;
+  }
+
+  return micro(cmdmicro);
+}
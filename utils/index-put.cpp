@@ -33,6 +33,7 @@
   #pragma warning(default: 4101)
 #endif
 
+#include <deque>
 #include <fstream>
 #include <memory>
 
@@ -48,10 +49,12 @@
 
 #include "common.hpp"
 #include "analysis/analyzers.hpp"
+#include "analysis/pre_analyzed_token_stream.hpp"
 #include "analysis/token_attributes.hpp"
 #include "analysis/token_streams.hpp"
 #include "index/index_writer.hpp"
 #include "store/store_utils.hpp"
+#include "utils/bytes_utils.hpp"
 #include "utils/directory_utils.hpp"
 #include "utils/index_utils.hpp"
 #include "utils/string_utils.hpp"
@@ -62,6 +65,7 @@
 NS_LOCAL
 
 const std::string HELP = "help";
+const std::string ANALYZED = "analyzed";
 const std::string BATCH_SIZE = "batch-size";
 const std::string CONSOLIDATE_ALL = "consolidate-all";
 const std::string INDEX_DIR = "index-dir";
@@ -70,7 +74,13 @@ const std::string INPUT = "in";
 const std::string MAX = "max-lines";
 const std::string THR = "threads";
 const std::string CONS_THR = "consolidation-threads";
+const std::string CONS_MAX_BYTES = "consolidation-max-bytes";
+const std::string CONS_RATE = "consolidation-rate";
 const std::string CPR = "commit-period";
+const std::string PIPELINE = "pipeline";
+const std::string PARSER_THR = "parser-threads";
+const std::string ANALYZER_THR = "analyzer-threads";
+const std::string QUEUE_SIZE = "queue-size";
 const std::string DIR_TYPE = "dir-type";
 const std::string FORMAT = "format";
 
@@ -189,12 +199,12 @@ struct Doc {
 
     TextField(const std::string& n, const irs::flags& flags)
       : Field(n, flags) {
-      stream = irs::analysis::analyzers::get(aname, aignore_format, aignore);
+      stream = irs::analysis::analyzers::get_pooled(aname, aignore_format, aignore);
     }
 
     TextField(const std::string& n, const irs::flags& flags, std::string& a)
       : Field(n, flags), f(a) {
-      stream = irs::analysis::analyzers::get(aname, aignore_format, aignore);
+      stream = irs::analysis::analyzers::get_pooled(aname, aignore_format, aignore);
     }
 
     irs::token_stream& get_tokens() const override {
@@ -208,6 +218,25 @@ struct Doc {
     }
   };
 
+  struct PreAnalyzedField : public Field {
+    irs::bytes_ref f; // references the input line
+    mutable irs::pre_analyzed_token_stream stream;
+
+    PreAnalyzedField(const std::string& n, const irs::flags& flags)
+      : Field(n, flags) {
+    }
+
+    irs::token_stream& get_tokens() const override {
+      stream.reset(f);
+      return stream;
+    }
+
+    bool write(irs::data_output& out) const override {
+      irs::write_string(out, f.c_str(), f.size());
+      return true;
+    }
+  };
+
   struct NumericField : public Field {
     mutable irs::numeric_token_stream stream;
     int64_t value;
@@ -284,7 +313,7 @@ const std::string& Doc::TextField::aignore = std::string("{\"locale\":\"en\", \"
 
 
 struct WikiDoc : Doc {
-  WikiDoc() {
+  explicit WikiDoc(bool analyzed) {
     // id
     elements.emplace_back(id = std::make_shared<StringField>(n_id, irs::flags::empty_instance()));
     store.emplace_back(elements.back());
@@ -300,12 +329,14 @@ struct WikiDoc : Doc {
     elements.push_back(ndate = std::make_shared<NumericField>(n_timesecnum, numeric_features));
 
     // body: text
-    elements.push_back(body = std::make_shared<TextField>(n_body, text_features));
+    if (analyzed) {
+      elements.push_back(analyzed_body = std::make_shared<PreAnalyzedField>(n_body, text_features));
+    } else {
+      elements.push_back(body = std::make_shared<TextField>(n_body, text_features));
+    }
   }
 
   virtual void fill(std::string* line) {
-    std::stringstream lineStream(*line);
-
     // id: uint64_t to string, base 36
     uint64_t id = next_id++; // atomic fetch and get
     char str[10];
@@ -316,16 +347,33 @@ struct WikiDoc : Doc {
     s = str2;
     std::replace(s.begin(), s.end(), ' ', '0');
 
+    // +date: uint64_t
+    uint64_t t = 0; //boost::posix_time::microsec_clock::local_time().total_milliseconds();
+    ndate->value = t;
+
+    if (analyzed_body) {
+      // the pre-analyzed body may contain any bytes, including tabs
+      const auto title_end = std::min(line->find('\t'), line->size());
+      const auto date_begin = std::min(title_end + 1, line->size());
+      const auto date_end = std::min(line->find('\t', date_begin), line->size());
+      const auto body_begin = std::min(date_end + 1, line->size());
+
+      title->f.assign(*line, 0, title_end);
+      date->f.assign(*line, date_begin, date_end - date_begin);
+      analyzed_body->f = irs::bytes_ref(
+        reinterpret_cast<const irs::byte_type*>(line->c_str()) + body_begin,
+        line->size() - body_begin);
+      return;
+    }
+
+    std::stringstream lineStream(*line);
+
     // title: string
     std::getline(lineStream, title->f, '\t');
 
     // date: string
     std::getline(lineStream, date->f, '\t');
 
-    // +date: uint64_t
-    uint64_t t = 0; //boost::posix_time::microsec_clock::local_time().total_milliseconds();
-    ndate->value = t;
-
     // body: text
     std::getline(lineStream, body->f, '\t');
   }
@@ -335,6 +383,140 @@ struct WikiDoc : Doc {
   std::shared_ptr<StringField> date;
   std::shared_ptr<NumericField> ndate;
   std::shared_ptr<TextField> body;
+  std::shared_ptr<PreAnalyzedField> analyzed_body;
+};
+
+// reads a record of the 'analyzed' input, i.e. a 32-bit big-endian size
+// followed by 'title \t date \t body' where body is a pre-analyzed field
+// as per irs::pre_analyzed_token_stream
+bool read_record(std::istream& stream, std::string& record) {
+  irs::byte_type size_buf[sizeof(uint32_t)];
+
+  if (!stream.read(reinterpret_cast<char*>(size_buf), sizeof size_buf)) {
+    return false;
+  }
+
+  const irs::byte_type* it = size_buf;
+  record.resize(irs::read<uint32_t>(it));
+
+  return record.empty()
+    || stream.read(&record[0], std::streamsize(record.size()));
+}
+
+// options of the staged ingestion pipeline:
+// reader -> parser pool -> analyzer pool -> writer pool
+struct pipeline_options {
+  bool enabled{false};
+  size_t parser_threads{1};
+  size_t analyzer_threads{1};
+  size_t queue_size{4}; // batches buffered between adjacent stages
+};
+
+// a document split into fields, body is pre-analyzed
+// once it has passed the analysis stage
+struct ParsedDoc {
+  std::string id;
+  std::string title;
+  std::string date;
+  std::string body;
+};
+
+typedef std::vector<ParsedDoc> ParsedBatch;
+
+// timings of a single pipeline stage accumulated over all its threads
+struct StageStats {
+  typedef std::chrono::steady_clock clock_t;
+
+  static uint64_t elapsed_us(const clock_t::time_point& start) {
+    return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(
+      clock_t::now() - start).count());
+  }
+
+  void print(const std::string& name, size_t threads, uint64_t total_us) const {
+    const auto docs_count = docs.load();
+    const auto batches_count = batches.load();
+    const auto busy = busy_us.load();
+
+    std::cout << "Stage " << name
+              << ": threads=" << threads
+              << " docs=" << docs_count
+              << " batches=" << batches_count
+              << " docs/s=" << (total_us ? docs_count * 1000000 / total_us : 0)
+              << " docs/s/thread=" << (busy ? docs_count * 1000000 / busy : 0)
+              << " batch_avg_us=" << (batches_count ? busy / batches_count : 0)
+              << " busy_ms=" << busy / 1000
+              << " input_wait_ms=" << input_wait_us.load() / 1000
+              << " output_wait_ms=" << output_wait_us.load() / 1000
+              << std::endl;
+  }
+
+  std::atomic<size_t> docs{0};
+  std::atomic<size_t> batches{0};
+  std::atomic<uint64_t> busy_us{0}; // time spent processing batches
+  std::atomic<uint64_t> input_wait_us{0}; // time spent waiting for input (starvation)
+  std::atomic<uint64_t> output_wait_us{0}; // time spent waiting for output (backpressure)
+};
+
+// a blocking FIFO of a limited capacity between two pipeline stages,
+// closed once the last of the producers is done
+template<typename T>
+class BoundedQueue {
+ public:
+  BoundedQueue(size_t capacity, size_t producers)
+    : capacity_(std::max(size_t(1), capacity)),
+      producers_(producers) {
+  }
+
+  void push(T&& value, StageStats& stats) {
+    const auto start = StageStats::clock_t::now();
+    SCOPED_LOCK_NAMED(mutex_, lock);
+
+    while (queue_.size() >= capacity_) {
+      not_full_.wait(lock);
+    }
+
+    stats.output_wait_us += StageStats::elapsed_us(start);
+    queue_.emplace_back(std::move(value));
+    not_empty_.notify_one();
+  }
+
+  // @return false if the queue is drained and all producers are done
+  bool pop(T& value, StageStats& stats) {
+    const auto start = StageStats::clock_t::now();
+    SCOPED_LOCK_NAMED(mutex_, lock);
+
+    while (queue_.empty() && producers_) {
+      not_empty_.wait(lock);
+    }
+
+    stats.input_wait_us += StageStats::elapsed_us(start);
+
+    if (queue_.empty()) {
+      return false;
+    }
+
+    value = std::move(queue_.front());
+    queue_.pop_front();
+    not_full_.notify_one();
+
+    return true;
+  }
+
+  void producer_done() {
+    SCOPED_LOCK(mutex_);
+
+    if (!--producers_) {
+      not_empty_.notify_all();
+    }
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::deque<T> queue_;
+  const size_t capacity_;
+  size_t producers_;
 };
 
 int put(
@@ -345,9 +527,13 @@ int put(
     size_t lines_max,
     size_t indexer_threads,
     size_t consolidation_threads,
+    size_t consolidation_max_bytes,
+    size_t consolidation_rate,
     size_t commit_interval_ms,
     size_t batch_size,
-    bool consolidate_all) {
+    bool consolidate_all,
+    bool analyzed,
+    pipeline_options pipeline) {
   auto dir = create_directory(dir_type, path);
 
   if (!dir) {
@@ -362,12 +548,25 @@ int put(
     return 1;
   }
 
-  auto writer = irs::index_writer::make(*dir, codec, irs::OM_CREATE);
+  irs::index_writer::init_options opts;
+  opts.merge_rate_limiter = std::make_shared<irs::rate_limiter>(consolidation_rate);
+
+  auto writer = irs::index_writer::make(*dir, codec, irs::OM_CREATE, opts);
 
   indexer_threads = (std::min)(indexer_threads, (std::numeric_limits<size_t>::max)() - 1 - consolidation_threads); // -1 for commiter thread
   indexer_threads = (std::max)(size_t(1), indexer_threads);
 
-  irs::async_utils::thread_pool thread_pool(indexer_threads + consolidation_threads + 1); // +1 for commiter thread
+  if (pipeline.enabled) {
+    pipeline.parser_threads = (std::max)(size_t(1), pipeline.parser_threads);
+    pipeline.analyzer_threads = analyzed ? 0 : (std::max)(size_t(1), pipeline.analyzer_threads); // nothing to analyze
+  } else {
+    pipeline.parser_threads = 0;
+    pipeline.analyzer_threads = 0;
+  }
+
+  irs::async_utils::thread_pool thread_pool(
+    indexer_threads + pipeline.parser_threads + pipeline.analyzer_threads
+    + consolidation_threads + 2); // +1 for commiter thread, +1 for reader thread
 
   SCOPED_TIMER("Total Time");
   std::cout << "Configuration: " << std::endl;
@@ -377,9 +576,19 @@ int put(
   std::cout << MAX << "=" << lines_max << std::endl;
   std::cout << THR << "=" << indexer_threads << std::endl;
   std::cout << CONS_THR << "=" << consolidation_threads << std::endl;
+  std::cout << CONS_MAX_BYTES << "=" << consolidation_max_bytes << std::endl;
+  std::cout << CONS_RATE << "=" << consolidation_rate << std::endl;
   std::cout << CPR << "=" << commit_interval_ms << std::endl;
   std::cout << BATCH_SIZE << "=" << batch_size << std::endl;
   std::cout << CONSOLIDATE_ALL << "=" << consolidate_all << std::endl;
+  std::cout << ANALYZED << "=" << analyzed << std::endl;
+  std::cout << PIPELINE << "=" << pipeline.enabled << std::endl;
+
+  if (pipeline.enabled) {
+    std::cout << PARSER_THR << "=" << pipeline.parser_threads << std::endl;
+    std::cout << ANALYZER_THR << "=" << pipeline.analyzer_threads << std::endl;
+    std::cout << QUEUE_SIZE << "=" << pipeline.queue_size << std::endl;
+  }
 
   struct {
     std::condition_variable cond_;
@@ -416,9 +625,13 @@ int put(
   batch_provider.done_.store(false);
   batch_provider.eof_ = false;
 
+  StageStats read_stats;
+  const auto start_time = StageStats::clock_t::now();
+
   // stream reader thread
-  thread_pool.run([&batch_provider, lines_max, batch_size, &stream]()->void {
+  thread_pool.run([&batch_provider, &read_stats, lines_max, batch_size, analyzed, &stream]()->void {
     SCOPED_TIMER("Stream read total time");
+    const auto start = StageStats::clock_t::now();
     SCOPED_LOCK_NAMED(batch_provider.mutex_, lock);
 
     for (auto i = lines_max ? lines_max : (std::numeric_limits<size_t>::max)(); i; --i) {
@@ -427,11 +640,13 @@ int put(
 
       auto& line = batch_provider.buf_.back();
 
-      if (std::getline(stream, line).eof()) {
+      if (analyzed ? !read_record(stream, line) : std::getline(stream, line).eof()) {
         batch_provider.buf_.pop_back();
         break;
       }
 
+      ++read_stats.docs;
+
       if (batch_size && batch_provider.buf_.size() >= batch_size) {
         SCOPED_TIMER("Stream read idle time");
         batch_provider.cond_.wait(lock);
@@ -439,6 +654,7 @@ int put(
     }
 
     batch_provider.eof_ = true;
+    read_stats.busy_us += StageStats::elapsed_us(start);
     std::cout << "EOF" << std::flush;
   });
 
@@ -467,7 +683,20 @@ int put(
   }
 
   // consolidation threads
-  const irs::index_utils::consolidate_tier consolidation_options;
+  irs::index_utils::consolidate_cost consolidation_options;
+  if (consolidation_max_bytes) {
+    // don't let concurrent consolidations saturate the disk
+    consolidation_options.max_consolidating_bytes = consolidation_max_bytes;
+  }
+  consolidation_options.on_decision = [](const irs::index_utils::consolidation_decision& decision) {
+    if (!decision.segments.empty()) {
+      std::cout << "CONSOLIDATE segments=" << decision.segments.size()
+                << " written=" << decision.bytes_written
+                << " reclaimed=" << decision.bytes_reclaimed
+                << " score=" << decision.score
+                << " reason=" << decision.reason << std::endl;
+    }
+  };
   auto policy = irs::index_utils::consolidation_policy(consolidation_options);
 
   for (size_t i = consolidation_threads; i; --i) {
@@ -494,11 +723,131 @@ int put(
     });
   }
 
+  StageStats parse_stats;
+  StageStats analyze_stats;
+  StageStats index_stats;
+  BoundedQueue<ParsedBatch> parsed_queue(pipeline.queue_size, pipeline.parser_threads);
+  BoundedQueue<ParsedBatch> analyzed_queue(
+    pipeline.queue_size,
+    pipeline.analyzer_threads ? pipeline.analyzer_threads : pipeline.parser_threads);
+
+  // parser threads, split lines into fields
+  for (size_t i = pipeline.parser_threads; i; --i) {
+    auto& out = pipeline.analyzer_threads ? parsed_queue : analyzed_queue;
+
+    thread_pool.run([&batch_provider, &parse_stats, &out, analyzed]()->void {
+      std::vector<std::string> buf;
+      WikiDoc doc(analyzed);
+
+      while (batch_provider.swap(buf)) {
+        const auto start = StageStats::clock_t::now();
+        ParsedBatch batch(buf.size());
+
+        for (size_t i = 0; i < buf.size(); ++i) {
+          auto& parsed = batch[i];
+
+          doc.fill(&(buf[i]));
+          parsed.id.swap(doc.id->f);
+          parsed.title.swap(doc.title->f);
+          parsed.date.swap(doc.date->f);
+
+          if (analyzed) {
+            parsed.body.assign(irs::ref_cast<char>(doc.analyzed_body->f));
+          } else {
+            parsed.body.swap(doc.body->f);
+          }
+        }
+
+        parse_stats.busy_us += StageStats::elapsed_us(start);
+        parse_stats.docs += batch.size();
+        ++parse_stats.batches;
+        out.push(std::move(batch), parse_stats);
+      }
+
+      out.producer_done();
+    });
+  }
+
+  // analyzer threads, replace text of the body with its tokens
+  for (size_t i = pipeline.analyzer_threads; i; --i) {
+    thread_pool.run([&parsed_queue, &analyzed_queue, &analyze_stats]()->void {
+      auto analyzer = irs::analysis::analyzers::get_pooled(
+        Doc::TextField::aname, Doc::TextField::aignore_format, Doc::TextField::aignore);
+      ParsedBatch batch;
+      irs::bstring tokens;
+
+      if (!analyzer) {
+        std::cerr << "Unable to get analyzer '" << Doc::TextField::aname << "'" << std::endl;
+      }
+
+      while (parsed_queue.pop(batch, analyze_stats)) {
+        const auto start = StageStats::clock_t::now();
+
+        for (auto& doc : batch) {
+          tokens.clear();
+
+          if (analyzer && analyzer->reset(doc.body)) {
+            irs::pre_analyzed_token_stream::write(
+              *analyzer, irs::pre_analyzed_token_stream::OFFSETS, tokens);
+          }
+
+          doc.body.assign(irs::ref_cast<char>(irs::bytes_ref(tokens)));
+        }
+
+        analyze_stats.busy_us += StageStats::elapsed_us(start);
+        analyze_stats.docs += batch.size();
+        ++analyze_stats.batches;
+        analyzed_queue.push(std::move(batch), analyze_stats);
+      }
+
+      analyzed_queue.producer_done();
+    });
+  }
+
+  // writer threads, invert pre-analyzed documents
+  for (size_t i = pipeline.enabled ? indexer_threads : 0; i; --i) {
+    thread_pool.run([&analyzed_queue, &index_stats, &writer]()->void {
+      ParsedBatch batch;
+      WikiDoc doc(true);
+      auto fill = [&doc](irs::segment_writer::document& builder, ParsedDoc& parsed) {
+        doc.id->f.swap(parsed.id);
+        doc.title->f.swap(parsed.title);
+        doc.date->f.swap(parsed.date);
+        doc.analyzed_body->f = irs::ref_cast<irs::byte_type>(irs::string_ref(parsed.body));
+
+        for (auto& field: doc.elements) {
+          builder.insert<irs::Action::INDEX>(*field);
+        }
+
+        for (auto& field : doc.store) {
+          builder.insert<irs::Action::STORE>(*field);
+        }
+      };
+
+      while (analyzed_queue.pop(batch, index_stats)) {
+        const auto start = StageStats::clock_t::now();
+
+        {
+          auto ctx = writer->documents();
+
+          for (auto begin = batch.begin(); begin != batch.end();) {
+            begin = ctx.insert(begin, batch.end(), fill);
+          }
+        }
+
+        index_stats.busy_us += StageStats::elapsed_us(start);
+        index_stats.docs += batch.size();
+        ++index_stats.batches;
+        std::cout << "." << std::flush; // newline in commit thread
+      }
+    });
+  }
+
   // indexer threads
-  for (size_t i = indexer_threads; i; --i) {
-    thread_pool.run([&batch_provider, &writer]()->void {
+  for (size_t i = pipeline.enabled ? 0 : indexer_threads; i; --i) {
+    thread_pool.run([&batch_provider, &writer, analyzed]()->void {
       std::vector<std::string> buf;
-      WikiDoc doc;
+      WikiDoc doc(analyzed);
 
       while (batch_provider.swap(buf)) {
         SCOPED_TIMER(std::string("Index batch ") + std::to_string(buf.size()));
@@ -527,6 +876,18 @@ int put(
 
   thread_pool.stop();
 
+  if (pipeline.enabled) {
+    const auto total_us = StageStats::elapsed_us(start_time);
+
+    std::cout << std::endl;
+    read_stats.print("read", 1, total_us);
+    parse_stats.print("parse", pipeline.parser_threads, total_us);
+    if (pipeline.analyzer_threads) {
+      analyze_stats.print("analyze", pipeline.analyzer_threads, total_us);
+    }
+    index_stats.print("index", indexer_threads, total_us);
+  }
+
   {
     SCOPED_TIMER("Commit time");
     std::cout << "COMMIT" << std::endl; // break indexer thread output by commit
@@ -543,6 +904,10 @@ int put(
 
   if (consolidate_all || consolidation_threads) {
     irs::directory_utils::remove_all_unreferenced(*dir);
+
+    std::cout << "Consolidation written=" << opts.merge_rate_limiter->bytes()
+              << " paused_ms=" << std::chrono::duration_cast<std::chrono::milliseconds>(opts.merge_rate_limiter->paused()).count()
+              << std::endl;
   }
 
   u_cleanup();
@@ -566,24 +931,33 @@ int put(const cmdline::parser& args) {
   const auto commit_interval_ms = args.exist(CPR) ? args.get<size_t>(CPR) : size_t(0);
   const auto indexer_threads = args.exist(THR) ? args.get<size_t>(THR) : size_t(0);
   const auto consolidation_threads = args.exist(CONS_THR) ? args.get<size_t>(CONS_THR) : size_t(0);
+  const auto consolidation_max_bytes = args.exist(CONS_MAX_BYTES) ? args.get<size_t>(CONS_MAX_BYTES) : size_t(0);
+  const auto consolidation_rate = args.exist(CONS_RATE) ? args.get<size_t>(CONS_RATE) : size_t(0);
   const auto lines_max = args.exist(MAX) ? args.get<size_t>(MAX) : size_t(0);
   const auto dir_type = args.exist(DIR_TYPE) ? args.get<std::string>(DIR_TYPE) : std::string("mmap");
   const auto format = args.exist(FORMAT) ? args.get<std::string>(FORMAT) : std::string("1_0");
+  const auto analyzed = args.exist(ANALYZED) ? args.get<bool>(ANALYZED) : false;
+
+  pipeline_options pipeline;
+  pipeline.enabled = args.exist(PIPELINE) ? args.get<bool>(PIPELINE) : false;
+  pipeline.parser_threads = args.exist(PARSER_THR) ? args.get<size_t>(PARSER_THR) : size_t(1);
+  pipeline.analyzer_threads = args.exist(ANALYZER_THR) ? args.get<size_t>(ANALYZER_THR) : size_t(1);
+  pipeline.queue_size = args.exist(QUEUE_SIZE) ? args.get<size_t>(QUEUE_SIZE) : size_t(4);
 
   if (args.exist(INPUT)) {
     const auto& file = args.get<std::string>(INPUT);
-    std::fstream in(file, std::fstream::in);
+    std::fstream in(file, analyzed ? std::fstream::in | std::fstream::binary : std::fstream::in);
 
     if (!in) {
       return 1;
     }
 
     return put(path, dir_type, format, in, lines_max, indexer_threads,
-               consolidation_threads, commit_interval_ms, batch_size, consolidate);
+               consolidation_threads, consolidation_max_bytes, consolidation_rate, commit_interval_ms, batch_size, consolidate, analyzed, pipeline);
   }
 
   return put(path, dir_type, format, std::cin, lines_max, indexer_threads, 
-             consolidation_threads, commit_interval_ms, batch_size, consolidate);
+             consolidation_threads, consolidation_max_bytes, consolidation_rate, commit_interval_ms, batch_size, consolidate, analyzed, pipeline);
 }
 
 int put(int argc, char* argv[]) {
@@ -599,7 +973,14 @@ int put(int argc, char* argv[]) {
   cmdput.add(MAX, 0, "Maximum lines", false, size_t(0));
   cmdput.add(THR, 0, "Number of insert threads", false, size_t(0));
   cmdput.add(CONS_THR, 0, "Number of consolidation threads", false, size_t(0));
+  cmdput.add(CONS_MAX_BYTES, 0, "Maximum number of bytes under consolidation at once, 0 - unlimited", false, size_t(0));
+  cmdput.add(CONS_RATE, 0, "Consolidation write rate in bytes per second, 0 - unlimited", false, size_t(0));
   cmdput.add(CPR, 0, "Commit period in lines", false, size_t(0));
+  cmdput.add(ANALYZED, 0, "Input consists of size-prefixed records with a pre-analyzed body", false, false);
+  cmdput.add(PIPELINE, 0, "Run parsing, analysis and indexing as separate stages", false, false);
+  cmdput.add(PARSER_THR, 0, "Number of parser threads in pipeline mode", false, size_t(1));
+  cmdput.add(ANALYZER_THR, 0, "Number of analyzer threads in pipeline mode", false, size_t(1));
+  cmdput.add(QUEUE_SIZE, 0, "Number of batches buffered between stages in pipeline mode", false, size_t(4));
 
   cmdput.parse(argc, argv);
 
@@ -33,6 +33,7 @@
   #pragma warning(default: 4101)
 #endif
 
+#include <array>
 #include <fstream>
 #include <random>
 #include <thread>
@@ -61,6 +62,7 @@
 #include "search/wildcard_filter.hpp"
 #include "search/ngram_similarity_filter.hpp"
 #include "store/fs_directory.hpp"
+#include "utils/math_utils.hpp"
 #include "utils/memory_pool.hpp"
 #include "utils/levenshtein_default_pdp.hpp"
 
@@ -93,6 +95,9 @@ const std::string TOPN = "topN";
 const std::string RND = "random";
 const std::string RPT = "repeat";
 const std::string CSV = "csv";
+const std::string JSON = "json";
+const std::string LABEL = "label";
+const std::string COUNT_BYTES = "count-bytes";
 const std::string SCORED_TERMS_LIMIT = "scored-terms-limit";
 const std::string SCORER = "scorer";
 const std::string SCORER_ARG = "scorer-arg";
@@ -204,6 +209,378 @@ struct timers_t {
   }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+/// @brief number of bytes read from the index by the current thread,
+///        maintained by 'counting_input'
+////////////////////////////////////////////////////////////////////////////////
+thread_local uint64_t thread_bytes_read = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class counting_input
+/// @brief index_input accounting all bytes read through it to the reading
+///        thread, inputs created by dup()/reopen() are accounted as well
+////////////////////////////////////////////////////////////////////////////////
+class counting_input final : public irs::index_input {
+ public:
+  static ptr make(ptr&& impl) {
+    return impl
+      ? index_input::make<counting_input>(std::move(impl))
+      : nullptr;
+  }
+
+  explicit counting_input(ptr&& impl) noexcept
+    : impl_(std::move(impl)) {
+  }
+
+  virtual irs::byte_type read_byte() override {
+    ++thread_bytes_read;
+    return impl_->read_byte();
+  }
+
+  virtual size_t read_bytes(irs::byte_type* b, size_t count) override {
+    const auto read = impl_->read_bytes(b, count);
+    thread_bytes_read += read;
+    return read;
+  }
+
+  virtual const irs::byte_type* read_buffer(size_t count, irs::BufferHint hint) override {
+    const auto* buf = impl_->read_buffer(count, hint);
+
+    if (buf) {
+      thread_bytes_read += count;
+    }
+
+    return buf;
+  }
+
+  virtual int32_t read_int() override {
+    thread_bytes_read += sizeof(uint32_t);
+    return impl_->read_int();
+  }
+
+  virtual int64_t read_long() override {
+    thread_bytes_read += sizeof(uint64_t);
+    return impl_->read_long();
+  }
+
+  virtual uint32_t read_vint() override {
+    const auto start = impl_->file_pointer();
+    const auto value = impl_->read_vint();
+    thread_bytes_read += impl_->file_pointer() - start;
+    return value;
+  }
+
+  virtual uint64_t read_vlong() override {
+    const auto start = impl_->file_pointer();
+    const auto value = impl_->read_vlong();
+    thread_bytes_read += impl_->file_pointer() - start;
+    return value;
+  }
+
+  virtual size_t file_pointer() const override { return impl_->file_pointer(); }
+  virtual size_t length() const override { return impl_->length(); }
+  virtual bool eof() const override { return impl_->eof(); }
+  virtual ptr dup() const override { return make(impl_->dup()); }
+  virtual ptr reopen() const override { return make(impl_->reopen()); }
+  virtual void seek(size_t pos) override { impl_->seek(pos); }
+
+  virtual int64_t checksum(size_t offset) const override {
+    return impl_->checksum(offset);
+  }
+
+ private:
+  ptr impl_;
+}; // counting_input
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class counting_directory
+/// @brief read-only view of a directory opening 'counting_input's
+////////////////////////////////////////////////////////////////////////////////
+class counting_directory final : public irs::directory {
+ public:
+  explicit counting_directory(irs::directory& impl) noexcept
+    : impl_(impl) {
+  }
+
+  using directory::attributes;
+  virtual irs::attribute_store& attributes() noexcept override {
+    return impl_.attributes();
+  }
+
+  virtual irs::index_output::ptr create(const std::string&) noexcept override {
+    return nullptr;
+  }
+
+  virtual bool exists(bool& result, const std::string& name) const noexcept override {
+    return impl_.exists(result, name);
+  }
+
+  virtual bool length(uint64_t& result, const std::string& name) const noexcept override {
+    return impl_.length(result, name);
+  }
+
+  virtual irs::index_lock::ptr make_lock(const std::string& name) noexcept override {
+    return impl_.make_lock(name);
+  }
+
+  virtual bool mtime(std::time_t& result, const std::string& name) const noexcept override {
+    return impl_.mtime(result, name);
+  }
+
+  virtual irs::index_input::ptr open(
+      const std::string& name,
+      irs::IOAdvice advice) const noexcept override {
+    try {
+      return counting_input::make(impl_.open(name, advice));
+    } catch (...) {
+      return nullptr;
+    }
+  }
+
+  virtual bool remove(const std::string&) noexcept override { return false; }
+  virtual bool rename(const std::string&, const std::string&) noexcept override { return false; }
+  virtual bool sync(const std::string&) noexcept override { return false; }
+
+  virtual bool visit(const visitor_f& visitor) const override {
+    return impl_.visit(visitor);
+  }
+
+ private:
+  irs::directory& impl_;
+}; // counting_directory
+
+////////////////////////////////////////////////////////////////////////////////
+/// @class latency_histogram
+/// @brief log-linear histogram in the spirit of HdrHistogram, values are
+///        bucketed with a relative error below 1/32
+////////////////////////////////////////////////////////////////////////////////
+class latency_histogram {
+ public:
+  static constexpr size_t SUB_BUCKETS = 64; // exact values below this one
+  static constexpr size_t SUB_BUCKET_BITS = 6; // log2(SUB_BUCKETS)
+  static constexpr size_t HALF_BUCKETS = SUB_BUCKETS / 2;
+  static constexpr size_t BUCKETS = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * HALF_BUCKETS;
+
+  static size_t index(uint64_t value) noexcept {
+    if (value < SUB_BUCKETS) {
+      return size_t(value);
+    }
+
+    // keep the SUB_BUCKET_BITS most significant bits
+    const size_t shift = irs::math::log2_64(value) + 1 - SUB_BUCKET_BITS;
+
+    return SUB_BUCKETS + (shift - 1) * HALF_BUCKETS
+      + size_t(value >> shift) - HALF_BUCKETS;
+  }
+
+  // @return the lowest value of the bucket at the specified index
+  static uint64_t value(size_t index) noexcept {
+    if (index < SUB_BUCKETS) {
+      return index;
+    }
+
+    index -= SUB_BUCKETS;
+    const size_t shift = index / HALF_BUCKETS + 1;
+
+    return uint64_t(index % HALF_BUCKETS + HALF_BUCKETS) << shift;
+  }
+
+  latency_histogram()
+    : counts_(BUCKETS, 0) {
+  }
+
+  void record(uint64_t value) noexcept {
+    ++counts_[index(value)];
+    ++count_;
+    sum_ += value;
+    max_ = std::max(max_, value);
+  }
+
+  void merge(const latency_histogram& other) noexcept {
+    for (size_t i = 0; i < BUCKETS; ++i) {
+      counts_[i] += other.counts_[i];
+    }
+
+    count_ += other.count_;
+    sum_ += other.sum_;
+    max_ = std::max(max_, other.max_);
+  }
+
+  // @param quantile in range [0..1]
+  uint64_t percentile(double_t quantile) const noexcept {
+    const auto rank = uint64_t(std::ceil(quantile * double_t(count_)));
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < BUCKETS; ++i) {
+      seen += counts_[i];
+
+      if (seen && seen >= rank) {
+        return std::min(value(i), max_);
+      }
+    }
+
+    return max_;
+  }
+
+  template<typename Visitor>
+  void visit(Visitor visitor) const {
+    for (size_t i = 0; i < BUCKETS; ++i) {
+      if (counts_[i]) {
+        visitor(value(i), counts_[i]);
+      }
+    }
+  }
+
+  uint64_t count() const noexcept { return count_; }
+  uint64_t max() const noexcept { return max_; }
+  uint64_t mean() const noexcept { return count_ ? sum_ / count_ : 0; }
+
+ private:
+  std::vector<uint64_t> counts_;
+  uint64_t count_{0};
+  uint64_t sum_{0};
+  uint64_t max_{0};
+}; // latency_histogram
+
+////////////////////////////////////////////////////////////////////////////////
+/// @brief statistics of the queries of a category, either of the first
+///        (cold) or of the subsequent (warm) runs of the queries
+////////////////////////////////////////////////////////////////////////////////
+struct query_stats {
+  void merge(const query_stats& other) {
+    latency.merge(other.latency);
+    building_us += other.building_us;
+    execution_us += other.execution_us;
+    docs_scored += other.docs_scored;
+    bytes_read += other.bytes_read;
+  }
+
+  latency_histogram latency; // building + execution, microseconds
+  uint64_t building_us{0};
+  uint64_t execution_us{0};
+  uint64_t docs_scored{0};
+  uint64_t bytes_read{0};
+};
+
+enum run_t { COLD, WARM, RUN_COUNT };
+
+typedef std::array<query_stats, RUN_COUNT> category_stats;
+
+const char* run_name(size_t run) {
+  return COLD == run ? "cold" : "warm";
+}
+
+std::string json_escape(const irs::string_ref& value) {
+  std::string out;
+
+  for (auto c : value) {
+    switch (c) {
+      case '"': out += "\\\""; break;
+      case '\\': out += "\\\\"; break;
+      case '\n': out += "\\n"; break;
+      case '\r': out += "\\r"; break;
+      case '\t': out += "\\t"; break;
+      default:
+        if (uint8_t(c) < 0x20) {
+          char buf[8];
+          snprintf(buf, sizeof buf, "\\u%04x", unsigned(uint8_t(c)));
+          out += buf;
+        } else {
+          out += c;
+        }
+    }
+  }
+
+  return out;
+}
+
+void print_stats(std::ostream& out, const std::vector<category_stats>& stats) {
+  out << "category,run,queries,p50_us,p90_us,p99_us,p999_us,max_us,mean_us,"
+         "building_mean_us,execution_mean_us,docs_scored_mean,bytes_read_mean\n";
+
+  for (size_t i = 0; i < stats.size(); ++i) {
+    for (size_t run = 0; run < RUN_COUNT; ++run) {
+      const auto& entry = stats[i][run];
+      const auto count = entry.latency.count();
+
+      if (!count) {
+        continue;
+      }
+
+      out << stringCategory(category_t(i)) << ',' << run_name(run) << ','
+          << count << ','
+          << entry.latency.percentile(0.5) << ','
+          << entry.latency.percentile(0.9) << ','
+          << entry.latency.percentile(0.99) << ','
+          << entry.latency.percentile(0.999) << ','
+          << entry.latency.max() << ','
+          << entry.latency.mean() << ','
+          << entry.building_us / count << ','
+          << entry.execution_us / count << ','
+          << entry.docs_scored / count << ','
+          << entry.bytes_read / count << '\n';
+    }
+  }
+
+  out.flush();
+}
+
+void print_json(
+    std::ostream& out,
+    const std::vector<std::pair<std::string, std::string>>& config,
+    const std::vector<category_stats>& stats) {
+  out << "{\n  \"config\": {";
+
+  for (size_t i = 0; i < config.size(); ++i) {
+    out << (i ? "," : "") << "\n    \"" << json_escape(config[i].first)
+        << "\": \"" << json_escape(config[i].second) << '"';
+  }
+
+  out << "\n  },\n  \"categories\": [";
+
+  bool first = true;
+
+  for (size_t i = 0; i < stats.size(); ++i) {
+    for (size_t run = 0; run < RUN_COUNT; ++run) {
+      const auto& entry = stats[i][run];
+      const auto count = entry.latency.count();
+
+      if (!count) {
+        continue;
+      }
+
+      out << (first ? "" : ",") << "\n    {"
+          << "\"category\": \"" << stringCategory(category_t(i)) << "\", "
+          << "\"run\": \"" << run_name(run) << "\", "
+          << "\"queries\": " << count << ", "
+          << "\"latency_us\": {"
+          << "\"p50\": " << entry.latency.percentile(0.5) << ", "
+          << "\"p90\": " << entry.latency.percentile(0.9) << ", "
+          << "\"p99\": " << entry.latency.percentile(0.99) << ", "
+          << "\"p99.9\": " << entry.latency.percentile(0.999) << ", "
+          << "\"max\": " << entry.latency.max() << ", "
+          << "\"mean\": " << entry.latency.mean() << "}, "
+          << "\"building_us\": " << entry.building_us << ", "
+          << "\"execution_us\": " << entry.execution_us << ", "
+          << "\"docs_scored\": " << entry.docs_scored << ", "
+          << "\"bytes_read\": " << entry.bytes_read << ", "
+          << "\"histogram\": [";
+
+      bool first_bucket = true;
+      entry.latency.visit([&out, &first_bucket](uint64_t value, uint64_t count) {
+        out << (first_bucket ? "" : ", ") << '[' << value << ", " << count << ']';
+        first_bucket = false;
+      });
+
+      out << "]}";
+      first = false;
+    }
+  }
+
+  out << "\n  ]\n}\n";
+  out.flush();
+}
+
 irs::string_ref splitFreq(const std::string& text) {
   static const std::regex freqPattern1("(\\S+)\\s*#\\s*(.+)"); // single term, prefix
   static const std::regex freqPattern2("\"(.+)\"\\s*#\\s*(.+)"); // phrase
@@ -436,7 +813,10 @@ int search(
     size_t scored_terms_limit,
     const std::string& scorer,
     const std::string& scorer_arg_format,
-    const irs::string_ref& scorer_arg) {
+    const irs::string_ref& scorer_arg,
+    const std::string& json,
+    const std::string& label,
+    bool count_bytes) {
   // build parametric descriptions for distances 1 and 2
   irs::default_pdp(1, false); irs::default_pdp(1, true);
   irs::default_pdp(2, false); irs::default_pdp(2, true);
@@ -497,14 +877,36 @@ int search(
   std::cout << SCORER << "=" << scorer << std::endl;
   std::cout << SCORER_ARG_FMT << "=" << scorer_arg_format << std::endl;
   std::cout << SCORER_ARG << "=" << scorer_arg << std::endl;
+  std::cout << JSON << "=" << json << std::endl;
+  std::cout << LABEL << "=" << label << std::endl;
+  std::cout << COUNT_BYTES << "=" << count_bytes << std::endl;
+
+  const std::vector<std::pair<std::string, std::string>> config = {
+    { LABEL, label },
+    { INDEX_DIR, path },
+    { DIR_TYPE, dir_type },
+    { FORMAT, format },
+    { MAX, std::to_string(tasks_max) },
+    { RPT, std::to_string(repeat) },
+    { THR, std::to_string(search_threads) },
+    { TOPN, std::to_string(limit) },
+    { RND, std::to_string(shuffle) },
+    { SCORED_TERMS_LIMIT, std::to_string(scored_terms_limit) },
+    { SCORER, scorer },
+    { SCORER_ARG_FMT, scorer_arg_format },
+    { SCORER_ARG, scorer_arg.null() ? std::string() : std::string(scorer_arg.c_str(), scorer_arg.size()) },
+    { COUNT_BYTES, std::to_string(count_bytes) }
+  };
 
+  counting_directory counting_dir(*dir);
   irs::directory_reader reader;
   irs::order::prepared order;
   irs::async_utils::thread_pool thread_pool(search_threads);
 
   {
     SCOPED_TIMER("Index read time");
-    reader = irs::directory_reader::open(*dir, codec);
+    reader = irs::directory_reader::open(
+      count_bytes ? static_cast<irs::directory&>(counting_dir) : *dir, codec);
   }
 
   {
@@ -521,6 +923,7 @@ int search(
     std::mt19937 randomizer;
     std::vector<task_t> tasks;
     std::vector<freelist_t::node_type> task_ids;
+    std::unique_ptr<std::atomic<bool>[]> executed; // task has been run at least once
     freelist_t task_list;
 
     void reset(std::vector<task_t>&& lines, size_t repeat, bool shuffle) {
@@ -530,6 +933,7 @@ int search(
 
       tasks = std::move(lines);
       task_ids.resize(tasks.size()*repeat);
+      executed.reset(new std::atomic<bool>[tasks.size()]());
 
       for (auto begin = task_ids.begin(), end = task_ids.end(); begin != end; ) {
         for (size_t i = 0; i < tasks.size(); ++i, ++begin) {
@@ -561,6 +965,11 @@ int search(
       return &tasks[task_id->value];
     }
 
+    // @return true for the first run of the specified task
+    bool cold(const task_t& task) noexcept {
+      return !executed[size_t(&task - tasks.data())].exchange(true);
+    }
+
   } task_provider;
 
   // prepare tasks set
@@ -571,9 +980,12 @@ int search(
     task_provider.reset(std::move(tasks), repeat, shuffle);
   }
 
+  std::mutex stats_mutex;
+  std::vector<category_stats> stats(size_t(category_t::UNKNOWN) + 1);
+
   // indexer threads
   for (size_t i = search_threads; i; --i) {
-    thread_pool.run([&task_provider, &reader, &order, limit, &out, csv, scored_terms_limit]()->void {
+    thread_pool.run([&task_provider, &reader, &order, limit, &out, csv, scored_terms_limit, &stats_mutex, &stats]()->void {
       static const std::string analyzer_name("text");
       static const std::string analyzer_args("{\"locale\":\"en\", \"stopwords\":[\"abc\", \"def\", \"ghi\"]}"); // from index-put
       auto analyzer = irs::analysis::analyzers::get(analyzer_name, irs::type<irs::text_format::json>::get(), analyzer_args);
@@ -585,6 +997,14 @@ int search(
       std::vector<std::pair<float_t, irs::doc_id_t>> sorted;
       sorted.reserve(limit);
 
+      typedef std::chrono::steady_clock clock_t;
+      std::vector<category_stats> thread_stats(stats.size());
+
+      auto elapsed_us = [](const clock_t::time_point& start) {
+        return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(
+          clock_t::now() - start).count());
+      };
+
       // process a single task
       for (const task_t* task; (task = task_provider.pop()) != nullptr;) {
         // this sleep circumvents context-switching penalties for CPU
@@ -594,13 +1014,18 @@ int search(
                 static_cast<unsigned>(100. * (static_cast<double>(rand()) / static_cast<double>(RAND_MAX)))));
         size_t doc_count = 0;
         const auto start = std::chrono::system_clock::now();
+        const auto bytes_read_start = thread_bytes_read;
+        const bool cold = task_provider.cold(*task);
+        uint64_t building_us, execution_us;
 
         sorted.clear();
 
         // parse task
         {
+          const auto building_start = clock_t::now();
           irs::timer_utils::scoped_timer timer(*(building_timers.stat[size_t(task->category)]));
           filter = prepareFilter(reader, order, task->category, task->text, analyzer, tmpBuf, scored_terms_limit);
+          building_us = elapsed_us(building_start);
 
           if (!filter) {
             continue;
@@ -610,6 +1035,7 @@ int search(
         // execute task
         {
           irs::timer_utils::scoped_timer timer(*(execution_timers.stat[size_t(task->category)]));
+          const auto execution_start = clock_t::now();
 
           const float EMPTY_SCORE = 0.f;
 
@@ -666,6 +1092,17 @@ int search(
                 return lhs.first < rhs.first;
             });
           }
+
+          execution_us = elapsed_us(execution_start);
+        }
+
+        {
+          auto& entry = thread_stats[size_t(task->category)][cold ? COLD : WARM];
+          entry.latency.record(building_us + execution_us);
+          entry.building_us += building_us;
+          entry.execution_us += execution_us;
+          entry.docs_scored += doc_count; // every matched document is scored
+          entry.bytes_read += thread_bytes_read - bytes_read_start;
         }
 
         const auto tdiff = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
@@ -690,11 +1127,33 @@ int search(
           out << ss.str();
         }
       }
+
+      SCOPED_LOCK(stats_mutex);
+
+      for (size_t i = 0; i < stats.size(); ++i) {
+        for (size_t run = 0; run < RUN_COUNT; ++run) {
+          stats[i][run].merge(thread_stats[i][run]);
+        }
+      }
     });
   }
 
   thread_pool.stop();
 
+  std::cout << "Query latency statistics:" << std::endl;
+  print_stats(std::cout, stats);
+
+  if (!json.empty()) {
+    std::fstream json_out(json, std::fstream::out | std::fstream::trunc);
+
+    if (!json_out) {
+      std::cerr << "Unable to open JSON output file '" << json << "'" << std::endl;
+      return 1;
+    }
+
+    print_json(json_out, config, stats);
+  }
+
   u_cleanup();
 
   return 0;
@@ -723,6 +1182,9 @@ int search(const cmdline::parser& args) {
   const auto scorer_arg_format = args.get<std::string>(SCORER_ARG_FMT);
   const auto dir_type = args.exist(DIR_TYPE) ? args.get<std::string>(DIR_TYPE) : std::string("mmap");
   const auto format = args.exist(FORMAT) ? args.get<std::string>(FORMAT) : std::string("1_0");
+  const auto json = args.exist(JSON) ? args.get<std::string>(JSON) : std::string();
+  const auto label = args.exist(LABEL) ? args.get<std::string>(LABEL) : std::string();
+  const bool count_bytes = args.exist(COUNT_BYTES);
 
   std::cout << "Max tasks in category="                      << maxtasks           << '\n'
             << "Task repeat count="                          << repeat             << '\n'
@@ -751,10 +1213,10 @@ int search(const cmdline::parser& args) {
       return 1;
     }
 
-    return search(path, dir_type, format, in, out, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
+    return search(path, dir_type, format, in, out, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg, json, label, count_bytes);
   }
 
-  return search(path, dir_type, format, in, std::cout, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg);
+  return search(path, dir_type, format, in, std::cout, maxtasks, repeat, thrs, topN, shuffle, csv, scored_terms_limit, scorer, scorer_arg_format, scorer_arg, json, label, count_bytes);
 }
 
 int search(int argc, char* argv[]) {
@@ -776,6 +1238,9 @@ int search(int argc, char* argv[]) {
   cmdsearch.add<std::string>(SCORER_ARG_FMT, 0, "Configuration argument format for query scorer", false, "json"); // 'json' is the argument format for 'bm25'
   cmdsearch.add(RND, 0, "Shuffle tasks");
   cmdsearch.add(CSV, 0, "CSV output");
+  cmdsearch.add<std::string>(JSON, 0, "Write per-category latency statistics as JSON to the specified file", false);
+  cmdsearch.add<std::string>(LABEL, 0, "Label of the run in JSON output, e.g. a commit id", false);
+  cmdsearch.add(COUNT_BYTES, 0, "Count bytes read from the index per query");
 
   cmdsearch.parse(argc, argv);
 